@@ -0,0 +1,840 @@
+/**
+ * @file benchmark_example.cpp
+ * @brief Micro-benchmarks for the SDK's per-cycle helpers
+ *
+ * This example measures (no robot connection required):
+ * - crc32_core vs. slicing-by-8 vs. PCLMUL CRC32 on a packed LowCmd
+ * - Scalar utils (lerp/clamp/deg2rad/rad2deg) vs. batched joint_math over 31 joints
+ * - TrajectoryStreamer evaluation of a whole-body quintic trajectory into LowCmd
+ * - CommandFilter (NaN rejection, position/rate limits, gain bounds) on a LowCmd
+ * - KinematicTransform MS <-> PJS conversion of positions, velocities and torques
+ * - MotorStatusMonitor status_bits decoding vs. a per-motor, per-flag loop
+ * - StatePredictor update/prediction of joint and IMU state over the command latency
+ * - LowStateRing SoA push vs. copying the LowState object
+ * - LowCmd fill from float arrays (fill_low_cmd) vs. per-motor setter calls
+ * - LowStateWindow min/max/mean aggregation used by LowStateRelay
+ * - Partial LowState decoding (LowStateView) vs. full CDR deserialization
+ * - Per-limb LowCmd composition (LowCmdComposer) vs. a mutex-protected shared command
+ * - ClockSync tick -> host time mapping under drift, tick wraparound and latency outliers
+ *
+ * Usage: ./benchmark_example [section]
+ *   section: crc | math | traj | filter | kin | status | predict | ring | arrays | relay | view | compose | sync | all (default: all)
+ */
+
+#include <chrono>
+#include <cmath>
+#include <cstring>
+#include <functional>
+#include <igris_sdk/clock_sync.hpp>
+#include <igris_sdk/command_filter.hpp>
+#include <igris_sdk/crc32.hpp>
+#include <igris_sdk/joint_math.hpp>
+#include <igris_sdk/kinematics.hpp>
+#include <igris_sdk/lowcmd_arrays.hpp>
+#include <igris_sdk/lowcmd_composer.hpp>
+#include <igris_sdk/lowstate_view.hpp>
+#include <igris_sdk/lowstate_window.hpp>
+#include <igris_sdk/motor_status.hpp>
+#include <igris_sdk/state_predictor.hpp>
+#include <igris_sdk/state_ring.hpp>
+#include <igris_sdk/trajectory_streamer.hpp>
+#include <igris_sdk/utils.hpp>
+#include <iomanip>
+#include <iostream>
+#include <mutex>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace igris_sdk;
+using namespace igris_c::msg::dds;
+
+// Keep the compiler from discarding benchmarked results
+template <typename T> inline void DoNotOptimize(const T &value) { asm volatile("" : : "r,m"(value) : "memory"); }
+
+// Run fn() `iters` times and return the mean time per call in nanoseconds (best of 5 rounds)
+double BenchNs(const std::function<void()> &fn, int iters) {
+    double best = 1e30;
+    for (int round = 0; round < 5; round++) {
+        auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < iters; i++) {
+            fn();
+        }
+        auto end  = std::chrono::steady_clock::now();
+        double ns = std::chrono::duration<double, std::nano>(end - start).count() / iters;
+        best      = std::min(best, ns);
+    }
+    return best;
+}
+
+void PrintResult(const std::string &name, double ns) {
+    std::cout << "  " << std::left << std::setw(36) << name << std::right << std::fixed << std::setprecision(1) << std::setw(10) << ns
+              << " ns" << std::endl;
+}
+
+// Example command with every motor populated
+LowCmd MakeSampleCmd() {
+    LowCmd cmd;
+    cmd.kinematic_mode(KinematicMode::PJS);
+    for (int i = 0; i < 31; i++) {
+        cmd.motors()[i] = create_motor_cmd(i, 0.01f * i, 0.0f, 0.0f, 50.0f, 0.5f);
+    }
+    return cmd;
+}
+
+// ========== CRC32 ==========
+
+bool BenchCrc() {
+    std::cout << "\n[CRC32] LowCmd = " << LOWCMD_CRC_WORDS << " words (" << LOWCMD_CRC_WORDS * 4 << " bytes)"
+              << ", PCLMUL: " << (crc32_has_clmul() ? "yes" : "no") << std::endl;
+
+    LowCmd cmd = MakeSampleCmd();
+    uint32_t words[LOWCMD_CRC_WORDS];
+    pack_lowcmd_words(cmd, words);
+
+    uint32_t ref = crc32_core(words, LOWCMD_CRC_WORDS);
+    bool ok      = crc32_core_slice8(words, LOWCMD_CRC_WORDS) == ref && crc32_core_fast(words, LOWCMD_CRC_WORDS) == ref &&
+              crc32_lowcmd(cmd) == ref;
+    std::cout << "  crc = 0x" << std::hex << ref << std::dec << (ok ? " (all variants match)" : " (MISMATCH)") << std::endl;
+
+    const int iters = 200000;
+    PrintResult("crc32_core (bytewise)", BenchNs([&] { DoNotOptimize(crc32_core(words, LOWCMD_CRC_WORDS)); }, iters));
+    PrintResult("crc32_core_slice8", BenchNs([&] { DoNotOptimize(crc32_core_slice8(words, LOWCMD_CRC_WORDS)); }, iters));
+    PrintResult("crc32_core_fast", BenchNs([&] { DoNotOptimize(crc32_core_fast(words, LOWCMD_CRC_WORDS)); }, iters));
+    PrintResult("crc32_lowcmd (pack + fast)", BenchNs([&] { DoNotOptimize(crc32_lowcmd(cmd)); }, iters));
+    return ok;
+}
+
+// ========== Joint math ==========
+
+// Count elements that differ bitwise from the scalar reference
+int CountMismatch(const JointArray &a, const JointArray &b) {
+    int n = 0;
+    for (size_t i = 0; i < a.size(); i++) {
+        n += std::memcmp(&a[i], &b[i], sizeof(float)) != 0;
+    }
+    return n;
+}
+
+bool BenchMath() {
+#if defined(IGRIS_SDK_JOINT_MATH_AVX)
+    const char *isa = "AVX (8 lanes)";
+#elif defined(IGRIS_SDK_JOINT_MATH_SSE)
+    const char *isa = "SSE2 (4 lanes)";
+#else
+    const char *isa = "scalar";
+#endif
+    std::cout << "\n[Joint math] " << igris_sdk::N_JOINTS << " joints, " << isa << std::endl;
+
+    std::mt19937 rng(42);
+    std::uniform_real_distribution<float> dist(-10.0f, 10.0f);
+    JointArray a, b, lo, hi, ref, out;
+    for (size_t i = 0; i < igris_sdk::N_JOINTS; i++) {
+        a[i]  = dist(rng);
+        b[i]  = dist(rng);
+        lo[i] = -1.0f - 0.1f * i;
+        hi[i] = 1.0f + 0.1f * i;
+    }
+    const float t = 0.37f;
+
+    // Correctness against the scalar utils (library) and wrap_to_pi
+    int mismatch = 0;
+    for (size_t i = 0; i < igris_sdk::N_JOINTS; i++) ref[i] = lerp(a[i], b[i], t);
+    mismatch += CountMismatch(ref, lerp_joints(a, b, t));
+    for (size_t i = 0; i < igris_sdk::N_JOINTS; i++) ref[i] = clamp(a[i], lo[i], hi[i]);
+    mismatch += CountMismatch(ref, clamp_joints(a, lo, hi));
+    for (size_t i = 0; i < igris_sdk::N_JOINTS; i++) ref[i] = deg2rad(a[i] * 30.0f);
+    for (size_t i = 0; i < igris_sdk::N_JOINTS; i++) out[i] = a[i] * 30.0f;
+    mismatch += CountMismatch(ref, deg2rad_joints(out));
+    for (size_t i = 0; i < igris_sdk::N_JOINTS; i++) ref[i] = rad2deg(a[i]);
+    mismatch += CountMismatch(ref, rad2deg_joints(a));
+    float wrap_err = 0.0f;
+    out            = wrap_to_pi_joints(a);
+    for (size_t i = 0; i < igris_sdk::N_JOINTS; i++) {
+        wrap_err = std::max(wrap_err, std::fabs(out[i] - wrap_to_pi(a[i])));
+    }
+
+    // wrap_to_pi boundaries: +-pi, +-3pi and their neighbours must stay in [-pi, pi)
+    const float PI = static_cast<float>(M_PI), PI3 = static_cast<float>(3.0 * M_PI);
+    JointArray edge;
+    const float edges[] = {PI, -PI, PI3, -PI3, 0.0f, 2.0f * PI, -2.0f * PI};
+    size_t n_edge       = 0;
+    for (float e : edges) {
+        for (float v : {std::nextafter(e, -INFINITY), e, std::nextafter(e, INFINITY)}) {
+            if (n_edge < edge.size()) edge[n_edge++] = v;
+        }
+    }
+    for (; n_edge < edge.size(); n_edge++) edge[n_edge] = std::nextafter(PI, 0.0f) - 1e-7f * n_edge;
+    out = wrap_to_pi_joints(edge);
+    int out_of_range = 0;
+    for (size_t i = 0; i < igris_sdk::N_JOINTS; i++) {
+        float ref_wrap = wrap_to_pi(edge[i]);
+        if (ref_wrap < -PI || ref_wrap >= PI || out[i] < -PI || out[i] >= PI) out_of_range++;
+        wrap_err = std::max(wrap_err, std::fabs(out[i] - ref_wrap));
+    }
+    bool ok = mismatch == 0 && wrap_err < 1e-6f && out_of_range == 0;
+    std::cout << "  bitwise mismatches vs scalar: " << mismatch << ", wrap_to_pi max err: " << wrap_err
+              << ", outside [-pi, pi): " << out_of_range << (ok ? " (OK)" : " (FAIL)") << std::endl;
+
+    const int iters = 200000;
+    PrintResult("lerp x31 (scalar utils)", BenchNs([&] {
+                    for (size_t i = 0; i < igris_sdk::N_JOINTS; i++) out[i] = lerp(a[i], b[i], t);
+                    DoNotOptimize(out);
+                }, iters));
+    PrintResult("lerp_joints", BenchNs([&] {
+                    lerp_joints(a.data(), b.data(), t, out.data(), igris_sdk::N_JOINTS);
+                    DoNotOptimize(out);
+                }, iters));
+    PrintResult("clamp x31 (scalar utils)", BenchNs([&] {
+                    for (size_t i = 0; i < igris_sdk::N_JOINTS; i++) out[i] = clamp(a[i], lo[i], hi[i]);
+                    DoNotOptimize(out);
+                }, iters));
+    PrintResult("clamp_joints", BenchNs([&] {
+                    clamp_joints(a.data(), lo.data(), hi.data(), out.data(), igris_sdk::N_JOINTS);
+                    DoNotOptimize(out);
+                }, iters));
+    PrintResult("deg2rad x31 (scalar utils)", BenchNs([&] {
+                    for (size_t i = 0; i < igris_sdk::N_JOINTS; i++) out[i] = deg2rad(a[i]);
+                    DoNotOptimize(out);
+                }, iters));
+    PrintResult("deg2rad_joints", BenchNs([&] {
+                    deg2rad_joints(a.data(), out.data(), igris_sdk::N_JOINTS);
+                    DoNotOptimize(out);
+                }, iters));
+    PrintResult("wrap_to_pi x31 (scalar)", BenchNs([&] {
+                    for (size_t i = 0; i < igris_sdk::N_JOINTS; i++) out[i] = wrap_to_pi(a[i]);
+                    DoNotOptimize(out);
+                }, iters));
+    PrintResult("wrap_to_pi_joints", BenchNs([&] {
+                    wrap_to_pi_joints(a.data(), out.data(), igris_sdk::N_JOINTS);
+                    DoNotOptimize(out);
+                }, iters));
+    return ok;
+}
+
+// ========== Trajectory streaming ==========
+
+bool BenchTraj() {
+    std::cout << "\n[Trajectory] " << igris_sdk::N_JOINTS << " joints, quintic, 1 kHz" << std::endl;
+
+    // Whole-body sine sampled every 10 ms, streamed while evaluating at 1 kHz
+    const double dt = 0.001, wp_dt = 0.01;
+    auto target     = [](double t, size_t j, JointArray &q, JointArray &dq) {
+        q[j]  = 0.3f * static_cast<float>(std::sin(2.0 * M_PI * 0.5 * t + 0.1 * j));
+        dq[j] = 0.3f * static_cast<float>(2.0 * M_PI * 0.5 * std::cos(2.0 * M_PI * 0.5 * t + 0.1 * j));
+    };
+    JointArray q, dq;
+    for (size_t j = 0; j < igris_sdk::N_JOINTS; j++) target(0.0, j, q, dq);
+
+    TrajectoryStreamer traj(SplineOrder::Quintic, 64);
+    traj.reset(q);
+    double next_wp = wp_dt;
+    auto stream    = [&](double now) {
+        // Keep a few waypoints ahead of the control clock
+        while (next_wp < now + 0.05) {
+            for (size_t j = 0; j < igris_sdk::N_JOINTS; j++) target(next_wp, j, q, dq);
+            if (!traj.push_waypoint(next_wp, q, dq)) break;
+            next_wp += wp_dt;
+        }
+    };
+
+    // Tracking error once the stream is running (waypoints are exact samples of the sine)
+    LowCmd cmd    = MakeSampleCmd();
+    float max_err = 0.0f;
+    for (int i = 0; i < 2000; i++) {
+        double now = i * dt;
+        stream(now);
+        traj.evaluate(now, cmd);
+        if (now < 0.1) continue;
+        for (size_t j = 0; j < igris_sdk::N_JOINTS; j++) {
+            target(now, j, q, dq);
+            max_err = std::max(max_err, std::fabs(cmd.motors()[j].q() - q[j]));
+        }
+    }
+    bool ok = max_err < 1e-4f;
+    std::cout << "  max tracking error vs. analytic: " << max_err << " rad" << (ok ? " (OK)" : " (FAIL)") << std::endl;
+
+    // Right arm keeps streaming while the left leg is in one long segment: the
+    // leg must not hold back the arm's queue
+    const uint32_t leg_mask = igris_sdk::LEFT_LEG_MASK, arm_mask = igris_sdk::RIGHT_ARM_MASK;
+    TrajectoryStreamer limbs(SplineOrder::Quintic, 64);
+    for (size_t j = 0; j < igris_sdk::N_JOINTS; j++) target(0.0, j, q, dq);
+    limbs.reset(q);
+    JointArray leg_q = q;
+    for (size_t j = 0; j < igris_sdk::N_JOINTS; j++) leg_q[j] += 0.5f;
+    limbs.push_waypoint(5.0, leg_q, leg_mask);
+    int rejected  = 0;
+    float arm_err = 0.0f;
+    next_wp       = wp_dt;
+    for (int i = 0; i < 3000; i++) {
+        double now = i * dt;
+        while (next_wp < now + 0.05) {
+            for (size_t j = 0; j < igris_sdk::N_JOINTS; j++) target(next_wp, j, q, dq);
+            if (!limbs.push_waypoint(next_wp, q, dq, arm_mask)) {
+                rejected++;
+                break;
+            }
+            next_wp += wp_dt;
+        }
+        limbs.evaluate(now, cmd);
+        if (now < 0.1) continue;
+        for (size_t j = 0; j < igris_sdk::N_JOINTS; j++) {
+            if (!(arm_mask & (1u << j))) continue;
+            target(now, j, q, dq);
+            arm_err = std::max(arm_err, std::fabs(cmd.motors()[j].q() - q[j]));
+        }
+    }
+    bool limbs_ok = rejected == 0 && arm_err < 1e-4f;
+    std::cout << "  arm stream during 5 s leg segment: " << rejected << " rejected, max error " << arm_err << " rad"
+              << (limbs_ok ? " (OK)" : " (FAIL)") << std::endl;
+    ok = ok && limbs_ok;
+
+    int tick = 2000;
+    PrintResult("evaluate (31 joints -> LowCmd)", BenchNs([&] {
+                    traj.evaluate(tick * dt, cmd);
+                    DoNotOptimize(cmd);
+                }, 100000));
+    PrintResult("push_waypoint + evaluate", BenchNs([&] {
+                    double now = tick++ * dt;
+                    stream(now);
+                    traj.evaluate(now, cmd);
+                    DoNotOptimize(cmd);
+                }, 100000));
+    return ok;
+}
+
+// ========== Command filter ==========
+
+bool BenchFilter() {
+    std::cout << "\n[Command filter] " << igris_sdk::N_JOINTS << " joints, PJS limits" << std::endl;
+
+    CommandFilter filter;
+    LowCmd cmd = MakeSampleCmd();
+    filter.apply(cmd);
+
+    // A step far outside the limits must be clamped and slew-limited, and NaN must be held
+    LowCmd bad = MakeSampleCmd();
+    for (auto &m : bad.motors()) m.q(100.0f);
+    bad.motors()[5].q(NAN);
+    bad.motors()[6].kp(-1.0f);
+    filter.apply(bad);
+    const float step = filter.config().max_acceleration[0] * filter.config().dt * filter.config().dt;
+    bool ok          = true;
+    for (size_t j = 0; j < igris_sdk::N_JOINTS; j++) {
+        const MotorCmd &m = bad.motors()[j];
+        ok &= std::isfinite(m.q()) && m.q() <= JOINT_POS_MAX[j] && m.kp() >= 0.0f;
+        ok &= std::fabs(m.q() - cmd.motors()[j].q()) <= step * 1.001f;
+    }
+    std::cout << "  limits respected: " << (ok ? "yes (OK)" : "no (FAIL)") << ", nan replaced: " << filter.stats().nan_replaced << std::endl;
+
+    // A 0 -> 1 rad step on joint 0 must settle on the target without overshoot, and a
+    // NaN right after reset(state) must be held with the hold gains (not kp = kd = 0)
+    CommandFilter step_filter;
+    LowState rest;
+    step_filter.reset(rest, KinematicMode::PJS);
+    LowCmd nan_cmd = MakeSampleCmd();
+    nan_cmd.motors()[0].q(NAN);
+    bool held = step_filter.apply(nan_cmd) && nan_cmd.motors()[0].q() == 0.0f &&
+                nan_cmd.motors()[0].kp() == step_filter.config().hold_kp[0] && nan_cmd.motors()[0].kd() == step_filter.config().hold_kd[0];
+    float peak = 0.0f, last = 0.0f;
+    int settled = -1;
+    for (int k = 0; k < 1000; k++) {
+        LowCmd target = MakeSampleCmd();
+        for (auto &m : target.motors()) m.q(0.0f);
+        target.motors()[0].q(1.0f);
+        step_filter.apply(target);
+        last = target.motors()[0].q();
+        peak = std::max(peak, last);
+        if (settled < 0 && last == 1.0f) settled = k;
+    }
+    bool settles = peak <= 1.0f && last == 1.0f;
+    std::cout << std::setprecision(9) << "  1 rad step: peak " << peak << " rad, settled after " << settled + 1 << " ms (" << (settles ? "OK" : "FAIL")
+              << "), nan hold gains: " << (held ? "yes (OK)" : "no (FAIL)") << std::endl;
+    ok = ok && settles && held;
+
+    const int iters = 200000;
+    LowCmd in       = MakeSampleCmd();
+    PrintResult("copy LowCmd (baseline)", BenchNs([&] {
+                    cmd = in;
+                    DoNotOptimize(cmd);
+                }, iters));
+    PrintResult("copy + CommandFilter::apply", BenchNs([&] {
+                    cmd = in;
+                    filter.apply(cmd);
+                    DoNotOptimize(cmd);
+                }, iters));
+    return ok;
+}
+
+// ========== Kinematic transform ==========
+
+bool BenchKin() {
+    std::cout << "\n[Kinematics] " << N_PARALLEL_PAIRS << " parallel pairs, MS <-> PJS" << std::endl;
+
+    // Placeholder differentials installed as if calibrated; a default transform must refuse commands
+    KinematicTransform kin(differential_linkage_models());
+    KinematicTransform uncalibrated;
+    std::mt19937 rng(7);
+    std::uniform_real_distribution<float> dist(-0.5f, 0.5f);
+    JointArray qm, dqm, taum, qj, dqj, tauj, back_q, back_dq, back_tau;
+    for (size_t i = 0; i < igris_sdk::N_JOINTS; i++) {
+        qm[i]   = dist(rng);
+        dqm[i]  = dist(rng);
+        taum[i] = 10.0f * dist(rng);
+    }
+
+    // Round trip, and power must be the same in both spaces
+    kin.motor_to_joint(qm.data(), dqm.data(), taum.data(), qj.data(), dqj.data(), tauj.data());
+    bool converted = kin.joint_to_motor(qj.data(), dqj.data(), tauj.data(), back_q.data(), back_dq.data(), back_tau.data());
+    float err = 0.0f, power_m = 0.0f, power_j = 0.0f;
+    for (size_t i = 0; i < igris_sdk::N_JOINTS; i++) {
+        err = std::max(err, std::max(std::fabs(back_q[i] - qm[i]), std::fabs(back_dq[i] - dqm[i])));
+        power_m += taum[i] * dqm[i];
+        power_j += tauj[i] * dqj[i];
+    }
+    bool ok = converted && err < 1e-5f && std::fabs(power_m - power_j) < 1e-4f;
+    std::cout << "  round-trip err: " << err << ", power mismatch: " << std::fabs(power_m - power_j) << (ok ? " (OK)" : " (FAIL)")
+              << std::endl;
+
+    LowCmd cmd   = MakeSampleCmd();
+    bool refused = !uncalibrated.convert(cmd, KinematicMode::MS) && cmd.kinematic_mode() == KinematicMode::PJS;
+    ok           = ok && refused;
+    std::cout << "  uncalibrated convert refused: " << (refused ? "yes (OK)" : "no (FAIL)") << std::endl;
+
+    const int iters = 200000;
+    PrintResult("motor_to_joint (q, dq, tau)", BenchNs([&] {
+                    kin.motor_to_joint(qm.data(), dqm.data(), taum.data(), qj.data(), dqj.data(), tauj.data());
+                    DoNotOptimize(qj);
+                }, iters));
+    PrintResult("joint_to_motor (q, dq, tau)", BenchNs([&] {
+                    kin.joint_to_motor(qj.data(), dqj.data(), tauj.data(), back_q.data(), back_dq.data(), back_tau.data());
+                    DoNotOptimize(back_q);
+                }, iters));
+    return ok;
+}
+
+// ========== Motor status decoding ==========
+
+bool BenchStatus() {
+    std::cout << "\n[Motor status] " << igris_sdk::N_JOINTS << " status words" << std::endl;
+
+    MotorStatusMonitor monitor;
+    LowState state;
+    state.motor_state()[4].status_bits(OVER_CURRENT_ERROR | LOW_VOLTAGE_ERROR);
+    size_t raised = monitor.update(state);
+    state.motor_state()[4].status_bits(LOW_VOLTAGE_ERROR);
+    size_t cleared = monitor.update(state);
+    size_t idle    = monitor.update(state);
+
+    MotorFaultEvent ev;
+    size_t events = 0;
+    while (monitor.pop(ev)) events++;
+    bool ok = raised == 2 && cleared == 1 && idle == 0 && events == 3 && monitor.cleared_count(OVER_CURRENT_ERROR) == 1;
+    std::cout << "  transitions: " << raised << " raised, " << cleared << " cleared, " << events << " events" << (ok ? " (OK)" : " (FAIL)")
+              << std::endl;
+
+    // Baseline: what a user loop checking every flag of every motor costs
+    const int iters = 200000;
+    PrintResult("naive 31 x 15 flag checks", BenchNs([&] {
+                    uint32_t n = 0;
+                    for (size_t m = 0; m < igris_sdk::N_JOINTS; m++) {
+                        uint32_t bits = state.motor_state()[m].status_bits();
+                        for (uint32_t b = 0; b < 15; b++) n += (bits >> b) & 1u;
+                    }
+                    DoNotOptimize(n);
+                }, iters));
+    PrintResult("MotorStatusMonitor::update (no change)", BenchNs([&] { DoNotOptimize(monitor.update(state)); }, iters));
+    return ok;
+}
+
+// ========== State prediction ==========
+
+bool BenchPredict() {
+    std::cout << "\n[State predictor] " << igris_sdk::N_JOINTS << " joints, 2 ms samples, 5 ms horizon" << std::endl;
+
+    // Sinusoidal motion of every joint, sampled at 500 Hz
+    auto q_at  = [](size_t j, double t) { return 0.5 * std::sin(2.0 * M_PI * (0.5 + 0.1 * j) * t); };
+    auto dq_at = [](size_t j, double t) {
+        double w = 2.0 * M_PI * (0.5 + 0.1 * j);
+        return 0.5 * w * std::cos(w * t);
+    };
+
+    StatePredictorConfig cfg;
+    cfg.horizon_us = 5000.0;
+    StatePredictor predictor(cfg);
+    LowState state;
+    PredictedState ps;
+    double err_pred = 0.0, err_stale = 0.0;
+    for (int k = 0; k < 2000; k++) {
+        double t = 0.002 * k;
+        for (size_t j = 0; j < igris_sdk::N_JOINTS; j++) {
+            state.joint_state()[j].q(static_cast<float>(q_at(j, t)));
+            state.joint_state()[j].dq(static_cast<float>(dq_at(j, t)));
+        }
+        uint64_t t_us = 2000 * static_cast<uint64_t>(k);
+        predictor.update(state, t_us);
+        if (k < 100) continue;  // let the filter converge
+        predictor.predict_at(t_us + 5000, ps);
+        for (size_t j = 0; j < igris_sdk::N_JOINTS; j++) {
+            double truth = q_at(j, t + 0.005);
+            err_pred     = std::max(err_pred, std::fabs(ps.q[j] - truth));
+            err_stale    = std::max(err_stale, std::fabs(state.joint_state()[j].q() - truth));
+        }
+    }
+    bool ok = err_pred < 0.25 * err_stale;
+    std::cout << "  max q error at +5 ms: predicted " << std::setprecision(5) << err_pred << " rad, last sample " << err_stale << " rad"
+              << (ok ? " (OK)" : " (FAIL)") << std::endl;
+
+    const int iters = 200000;
+    uint64_t t_us   = 4000000;
+    PrintResult("StatePredictor::update", BenchNs([&] {
+                    t_us += 2000;
+                    predictor.update(state, t_us);
+                }, iters));
+    PrintResult("StatePredictor::predict_at", BenchNs([&] {
+                    predictor.predict_at(t_us + 5000, ps);
+                    DoNotOptimize(ps);
+                }, iters));
+    return ok;
+}
+
+// ========== LowState ring ==========
+
+bool BenchRing() {
+    LowStateRing ring(1024);
+    std::cout << "\n[State ring] " << ring.capacity() << " slots, SoA columns" << std::endl;
+
+    // Columns must hold the pushed values at the slot of their sequence number
+    LowState state;
+    for (uint32_t k = 0; k < 3000; k++) {
+        state.tick(k);
+        state.joint_state()[7].q(0.5f * k);
+        state.imu_state().gyroscope()[2] = -1.0f * k;
+        ring.push(state, k);
+    }
+    uint64_t last  = ring.sequence() - 1;
+    ArrayView view = ring.view(LowStateField::JointQ);
+    const float *q = static_cast<const float *>(view.data) + ring.slot(last) * view.shape[1];
+    bool ok        = view.ndim == 2 && view.shape[1] == 31 && view.strides[0] == 31 * sizeof(float) && q[7] == 0.5f * 2999 &&
+              *ring.at<uint32_t>(LowStateField::Tick, last) == 2999 && ring.at<float>(LowStateField::ImuGyroscope, last)[2] == -2999.0f &&
+              ring.readable(last) && !ring.readable(last - ring.capacity());
+    std::cout << "  views match pushed samples: " << (ok ? "yes (OK)" : "no (FAIL)") << std::endl;
+
+    const int iters = 200000;
+    LowState copy;
+    PrintResult("copy LowState (baseline)", BenchNs([&] {
+                    copy = state;
+                    DoNotOptimize(copy);
+                }, iters));
+    PrintResult("LowStateRing::push", BenchNs([&] { ring.push(state, 0); }, iters));
+    return ok;
+}
+
+// ========== LowCmd from arrays ==========
+
+bool BenchArrays() {
+    std::cout << "\n[LowCmd arrays] " << igris_sdk::N_JOINTS << " motors x 6 fields" << std::endl;
+
+    JointArray q, dq, tau, kp, kd;
+    for (size_t i = 0; i < igris_sdk::N_JOINTS; i++) {
+        q[i]   = 0.01f * i;
+        dq[i]  = 0.0f;
+        tau[i] = 0.0f;
+        kp[i]  = 50.0f;
+        kd[i]  = 0.5f;
+    }
+
+    LowCmd cmd, ref = MakeSampleCmd();
+    fill_low_cmd(cmd, q.data(), dq.data(), tau.data(), kp.data(), kd.data(), KinematicMode::PJS);
+    bool ok = cmd == ref;
+    std::cout << "  matches per-motor construction: " << (ok ? "yes (OK)" : "no (FAIL)") << std::endl;
+
+    // Native cost only: from Python, the setter path additionally pays one binding call per setter
+    const int iters = 200000;
+    PrintResult("per-motor setters (31 x 6 calls)", BenchNs([&] {
+                    for (size_t i = 0; i < igris_sdk::N_JOINTS; i++) {
+                        MotorCmd &m = cmd.motors()[i];
+                        m.id(static_cast<uint16_t>(i));
+                        m.q(q[i]);
+                        m.dq(dq[i]);
+                        m.tau(tau[i]);
+                        m.kp(kp[i]);
+                        m.kd(kd[i]);
+                    }
+                    cmd.kinematic_mode(KinematicMode::PJS);
+                    DoNotOptimize(cmd);
+                }, iters));
+    PrintResult("fill_low_cmd (5 arrays)", BenchNs([&] {
+                    fill_low_cmd(cmd, q.data(), dq.data(), tau.data(), kp.data(), kd.data(), KinematicMode::PJS);
+                    DoNotOptimize(cmd);
+                }, iters));
+    return ok;
+}
+
+// ========== LowState relay window ==========
+
+bool BenchRelay() {
+    std::cout << "\n[Relay window] " << igris_sdk::detail::LOWSTATE_FLOATS << " float fields, 50 samples/window (500Hz -> 10Hz)" << std::endl;
+
+    // Mean/min/max per field, status_bits OR-ed over the window, quantized outputs
+    LowStateWindow window;
+    LowState state;
+    for (uint32_t k = 0; k < 50; k++) {
+        state.tick(k);
+        state.joint_state()[3].q(0.01f * k);
+        state.imu_state().rpy()[0] = -0.002f * k;
+        state.motor_state()[5].status_bits(k == 17 ? 0x4u : 0u);
+        window.push(state);
+    }
+    LowState mean, min, max;
+    bool ok = window.take(mean, &min, &max, 1e-3f) && window.count() == 0;
+    ok      = ok && std::fabs(mean.joint_state()[3].q() - 0.245f) < 1e-6f && min.joint_state()[3].q() == 0.0f &&
+         std::fabs(max.joint_state()[3].q() - 0.49f) < 1e-6f && std::fabs(mean.imu_state().rpy()[0] + 0.049f) < 1e-6f &&
+         mean.motor_state()[5].status_bits() == 0x4u && mean.tick() == 49;
+    std::cout << "  mean/min/max/status match: " << (ok ? "yes (OK)" : "no (FAIL)") << std::endl;
+
+    // Orientation: yaw alternating across +-pi, quaternion alternating between q and -q
+    for (uint32_t k = 0; k < 50; k++) {
+        const float s              = k % 2 ? -1.0f : 1.0f;
+        state.imu_state().rpy()[2] = s * (3.14159265f - 0.01f);
+        state.imu_state().quaternion({s * 0.6f, 0.0f, 0.0f, s * 0.8f});
+        window.push(state);
+    }
+    window.take(mean, &min, &max);
+    const auto &q    = mean.imu_state().quaternion();
+    bool orientation = std::fabs(std::fabs(mean.imu_state().rpy()[2]) - 3.14159265f) < 1e-5f && std::fabs(q[0] - 0.6f) < 1e-6f &&
+                       std::fabs(q[3] - 0.8f) < 1e-6f && max.imu_state().rpy()[2] == mean.imu_state().rpy()[2] &&
+                       min.imu_state().quaternion() == q;
+    ok               = ok && orientation;
+    std::cout << "  yaw across +-pi, quaternion sign flips: " << (orientation ? "mean ok (OK)" : "wrong mean (FAIL)") << std::endl;
+
+    const int iters = 200000;
+    PrintResult("LowStateWindow::push", BenchNs([&] { window.push(state); }, iters));
+    PrintResult("push x50 + take (mean, min, max)", BenchNs([&] {
+                    for (int k = 0; k < 50; k++) window.push(state);
+                    window.take(mean, &min, &max, 1e-3f);
+                    DoNotOptimize(mean);
+                }, iters / 50));
+    return ok;
+}
+
+// ========== Partial LowState decoding ==========
+
+template <typename T> static bool DecodeCdr(std::vector<unsigned char> &buffer, T &out) {
+    org::eclipse::cyclonedds::core::cdr::basic_cdr_stream str;
+    str.set_buffer(buffer.data(), buffer.size());
+    return read(str, out, false);
+}
+
+bool BenchView() {
+    using org::eclipse::cyclonedds::core::cdr::basic_cdr_stream;
+
+    LowState state;
+    state.tick(42);
+    state.imu_state().gyroscope()[1] = 0.25f;
+    for (size_t i = 0; i < igris_sdk::N_JOINTS; i++) {
+        state.motor_state()[i].q(0.01f * i);
+        state.joint_state()[i].q(-0.01f * i);
+        state.joint_state()[i].dq(0.1f * i);
+    }
+    basic_cdr_stream sizer;
+    move(sizer, state, false);
+    std::vector<unsigned char> buffer(sizer.position());
+    basic_cdr_stream writer;
+    writer.set_buffer(buffer.data(), buffer.size());
+    write(writer, state, false);
+    std::cout << "\n[LowState view] " << buffer.size() << " byte CDR sample (XCDR1)" << std::endl;
+
+    // Views must decode exactly their fields, and agree with the full decode
+    using ImuView = LowStateView<LOWSTATE_TICK | LOWSTATE_IMU>;
+    using LegView = LowStateView<LOWSTATE_JOINT_Q | LOWSTATE_JOINT_DQ, 0, 12>;
+    LowState full;
+    ImuView imu;
+    LegView leg;
+    LowStateView<LOWSTATE_ALL> all;
+    bool ok = DecodeCdr(buffer, full) && DecodeCdr(buffer, imu) && DecodeCdr(buffer, leg) && DecodeCdr(buffer, all);
+    ok      = ok && full == state && all.state() == state && imu.state().tick() == 42 && imu.state().imu_state().gyroscope()[1] == 0.25f &&
+         imu.state().joint_state()[3].q() == 0.0f && leg.state().joint_state()[11].dq() == state.joint_state()[11].dq() &&
+         leg.state().joint_state()[12].q() == 0.0f && leg.state().motor_state()[5].q() == 0.0f;
+    std::cout << "  views decode selected fields only: " << (ok ? "yes (OK)" : "no (FAIL)") << std::endl;
+
+    const int iters = 200000;
+    PrintResult("full LowState deserialization", BenchNs([&] {
+                    DecodeCdr(buffer, full);
+                    DoNotOptimize(full);
+                }, iters));
+    PrintResult("LowStateView<ALL>", BenchNs([&] {
+                    DecodeCdr(buffer, all);
+                    DoNotOptimize(all);
+                }, iters));
+    PrintResult("LowStateView<TICK | IMU>", BenchNs([&] {
+                    DecodeCdr(buffer, imu);
+                    DoNotOptimize(imu);
+                }, iters));
+    PrintResult("LowStateView<JOINT_Q | JOINT_DQ, 0, 12>", BenchNs([&] {
+                    DecodeCdr(buffer, leg);
+                    DoNotOptimize(leg);
+                }, iters));
+    return ok;
+}
+
+// ========== Per-limb LowCmd composition ==========
+
+bool BenchCompose() {
+    std::cout << "\n[LowCmd composer] 5 limbs (waist, legs, left/right arm, neck), single thread" << std::endl;
+
+    JointArray q, dq, tau, kp, kd;
+    for (size_t i = 0; i < igris_sdk::N_JOINTS; i++) {
+        q[i]   = 0.01f * i;
+        dq[i]  = 0.0f;
+        tau[i] = 0.0f;
+        kp[i]  = 50.0f;
+        kd[i]  = 0.5f;
+    }
+
+    LowCmdComposer composer(KinematicMode::PJS);
+    const int waist = composer.add_limb("waist", MotorIndex::WAIST_YAW, 3);
+    const int legs  = composer.add_limb("legs", MotorIndex::L_HIP_PITCH, 12);
+    const int larm  = composer.add_limb("left_arm", MotorIndex::L_SHOULDER_PITCH, 7, 10000, StaleAction::Damping);
+    const int rarm  = composer.add_limb("right_arm", MotorIndex::R_SHOULDER_PITCH, 7);
+    const int neck  = composer.add_limb("neck", MotorIndex::NECK_YAW, 2);
+    const int limbs[5][3] = {{waist, MotorIndex::WAIST_YAW, 3},
+                             {legs, MotorIndex::L_HIP_PITCH, 12},
+                             {larm, MotorIndex::L_SHOULDER_PITCH, 7},
+                             {rarm, MotorIndex::R_SHOULDER_PITCH, 7},
+                             {neck, MotorIndex::NECK_YAW, 2}};  // id, first motor, count
+    auto write_limb = [&](int limb, int first) {
+        composer.write(limb, &q[first], &dq[first], &tau[first], &kp[first], &kd[first]);
+    };
+
+    // A limb that never wrote is stale (damped: kp = 0); once all wrote, the result equals the whole-body command
+    LowCmd cmd, ref = MakeSampleCmd();
+    write_limb(waist, MotorIndex::WAIST_YAW);
+    write_limb(legs, MotorIndex::L_HIP_PITCH);
+    write_limb(rarm, MotorIndex::R_SHOULDER_PITCH);
+    write_limb(neck, MotorIndex::NECK_YAW);
+    bool ok = composer.compose(cmd) == (1u << larm) && cmd.motors()[MotorIndex::L_ELBOW].kp() == 0.0f;
+    write_limb(larm, MotorIndex::L_SHOULDER_PITCH);
+    ok = ok && composer.compose(cmd) == 0 && cmd == ref;
+    std::cout << "  stale limb damped, composed == whole-body command: " << (ok ? "yes (OK)" : "no (FAIL)") << std::endl;
+
+    // Baseline: every controller copies its range into one shared command under a mutex
+    std::mutex mutex;
+    LowCmd shared = ref;
+    const int iters = 200000;
+    PrintResult("mutex: lock + write 5 limbs", BenchNs([&] {
+                    for (const auto &l : limbs) {
+                        std::lock_guard<std::mutex> lock(mutex);
+                        for (int j = l[1]; j < l[1] + l[2]; j++) {
+                            MotorCmd &m = shared.motors()[j];
+                            m.q(q[j]);
+                            m.dq(dq[j]);
+                            m.tau(tau[j]);
+                            m.kp(kp[j]);
+                            m.kd(kd[j]);
+                        }
+                    }
+                    DoNotOptimize(shared);
+                }, iters));
+    PrintResult("mutex: lock + copy LowCmd", BenchNs([&] {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    cmd = shared;
+                    DoNotOptimize(cmd);
+                }, iters));
+    PrintResult("composer: write 5 limbs", BenchNs([&] {
+                    for (const auto &l : limbs) write_limb(l[0], l[1]);
+                }, iters));
+    PrintResult("composer: compose (5 limbs)", BenchNs([&] {
+                    composer.compose(cmd);
+                    DoNotOptimize(cmd);
+                }, iters));
+    return ok;
+}
+
+// ========== Clock synchronization ==========
+
+bool BenchSync() {
+    // Robot ticks at 1 kHz on a clock 50 ppm slower than the host, starting 5 s before
+    // the 32-bit tick wraps; every sample arrives 200 us after it was produced plus
+    // 0-20 us jitter, and every 50th one is delayed by another 2 ms (one-sided outliers)
+    const double period_us = 1000.05, base_us = 200.0;
+    const uint32_t tick0   = 0xFFFFFFFFu - 5000u;
+    const uint64_t host0   = 1000000000000ull;
+    const int n            = 30000;
+    std::cout << "\n[Clock sync] " << n / 1000 << " s at 1 kHz, 50 ppm drift, tick wrap at 5 s, 2% outliers" << std::endl;
+
+    std::mt19937 rng(7);
+    std::uniform_real_distribution<double> jitter(0.0, 20.0);
+    auto produced = [&](int i) { return host0 + static_cast<uint64_t>(std::llround(i * period_us)); };
+
+    ClockSync sync;
+    double max_err = 0.0, true_latency = 0.0;
+    for (int i = 0; i < n; i++) {
+        double delay = jitter(rng) + (i % 50 == 49 ? 2000.0 : 0.0);
+        sync.add_sample(tick0 + static_cast<uint32_t>(i), produced(i) + static_cast<uint64_t>(std::llround(base_us + delay)));
+        // Same EWMA as ClockSync, over the true latency above the 200 us floor
+        true_latency += ClockSyncConfig().latency_alpha * (delay - true_latency);
+        if (i >= 2000) {
+            // Mapping is relative to the fastest samples, so the floor is not observable
+            double t = static_cast<double>(static_cast<int64_t>(sync.tick_to_host_time(tick0 + static_cast<uint32_t>(i)) - produced(i)));
+            max_err  = std::max(max_err, std::fabs(t - base_us));
+        }
+    }
+    ClockSyncStats stats = sync.stats();
+    bool map_ok          = stats.synced && max_err < 10.0 && std::fabs(stats.tick_period_us - period_us) < 0.005;
+    bool latency_ok      = std::fabs(stats.latency_mean_us - true_latency) < 10.0;
+    std::cout << std::fixed << std::setprecision(2) << "  tick_to_host_time max err (2-30 s, across wrap): " << max_err << " us, period " << stats.tick_period_us
+              << " us (true " << period_us << ")" << (map_ok ? " (OK)" : " (FAIL)") << std::endl;
+    std::cout << "  latency mean: " << stats.latency_mean_us << " us (true " << true_latency << " us)" << (latency_ok ? " (OK)" : " (FAIL)")
+              << std::endl;
+
+    const int iters = 200000;
+    uint32_t tick   = tick0 + n;
+    uint64_t host   = produced(n);
+    PrintResult("ClockSync::add_sample", BenchNs([&] {
+                    sync.add_sample(tick++, host);
+                    host += 1000;
+                }, iters));
+    PrintResult("ClockSync::tick_to_host_time", BenchNs([&] { DoNotOptimize(sync.tick_to_host_time(tick)); }, iters));
+    return map_ok && latency_ok;
+}
+
+int main(int argc, char **argv) {
+    std::string section = argc > 1 ? argv[1] : "all";
+
+    struct Section {
+        const char *name;
+        bool (*run)();
+    };
+    const std::vector<Section> sections = {
+        {"crc", BenchCrc},
+        {"math", BenchMath},
+        {"traj", BenchTraj},
+        {"filter", BenchFilter},
+        {"kin", BenchKin},
+        {"status", BenchStatus},
+        {"predict", BenchPredict},
+        {"ring", BenchRing},
+        {"arrays", BenchArrays},
+        {"relay", BenchRelay},
+        {"view", BenchView},
+        {"compose", BenchCompose},
+        {"sync", BenchSync},
+    };
+
+    std::cout << "=== IGRIS SDK Benchmarks ===" << std::endl;
+
+    bool ok = true, found = false;
+    for (const auto &s : sections) {
+        if (section == "all" || section == s.name) {
+            found = true;
+            ok &= s.run();
+        }
+    }
+
+    if (!found) {
+        std::cerr << "Unknown section: " << section << std::endl;
+        return 1;
+    }
+    return ok ? 0 : 1;
+}
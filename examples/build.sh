@@ -40,8 +40,14 @@ echo -e "${GREEN}Executables:${NC}"
 echo -e "  ${BUILD_DIR}/sdk_gui_client"
 echo -e "  ${BUILD_DIR}/lowlevel_example"
 echo -e "  ${BUILD_DIR}/service_example"
+echo -e "  ${BUILD_DIR}/benchmark_example"
+echo -e "  ${BUILD_DIR}/startup_benchmark"
+echo -e "  ${BUILD_DIR}/multi_robot_benchmark"
 echo ""
 echo -e "${YELLOW}Usage:${NC}"
 echo -e "  ./service_example [domain_id]    - Service API (menu-based)"
 echo -e "  ./lowlevel_example [domain_id]   - Pub/Sub low-level control"
 echo -e "  ./sdk_gui_client [domain_id]     - Full GUI client"
+echo -e "  ./benchmark_example [section]    - SDK utility micro-benchmarks"
+echo -e "  ./startup_benchmark [domain_id] [robot_ip ...] - Time to first LowState"
+echo -e "  ./multi_robot_benchmark [robots] [--shared]    - CPU/memory per robot"
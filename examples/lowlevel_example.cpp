@@ -13,6 +13,7 @@
 #include <atomic>
 #include <chrono>
 #include <cmath>
+#include <condition_variable>
 #include <csignal>
 #include <igris_sdk/channel_factory.hpp>
 #include <igris_sdk/igris_c_client.hpp>
@@ -34,6 +35,7 @@ static const int NECK_PITCH = 30;
 static std::atomic<bool> g_running(true);
 static std::mutex g_state_mutex;
 static LowState g_latest_state;
+static std::condition_variable g_state_cv;
 static bool g_state_received = false;
 
 // Initial positions (captured on first state receive)
@@ -53,6 +55,7 @@ void LowStateCallback(const LowState &state) {
             g_initial_pos[i] = state.joint_state()[i].q();
         }
         g_state_received = true;
+        g_state_cv.notify_all();
         std::cout << "Initial state captured" << std::endl;
     }
 }
@@ -93,10 +96,18 @@ int main(int argc, char **argv) {
     }
     std::cout << "LowCmd publisher initialized" << std::endl;
 
-    // Wait for first state
+    // Wait until the robot's LowCmd reader is matched (commands written before that are lost)
+    std::cout << "Waiting for robot..." << std::endl;
+    while (g_running && !cmd_pub.wait_for_subscribers(1, 100)) {
+    }
+
+    // Wait for first state (100ms slices to stay responsive to Ctrl+C)
     std::cout << "Waiting for robot state..." << std::endl;
-    while (!g_state_received && g_running) {
-        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    {
+        std::unique_lock<std::mutex> lock(g_state_mutex);
+        while (g_running && !g_state_received) {
+            g_state_cv.wait_for(lock, std::chrono::milliseconds(100));
+        }
     }
 
     if (!g_running) {
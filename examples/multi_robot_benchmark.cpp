@@ -0,0 +1,174 @@
+/**
+ * @file multi_robot_benchmark.cpp
+ * @brief CPU and memory cost per robot in a multi-robot process
+ *
+ * This example demonstrates:
+ * - One ChannelFactory (DomainParticipant) per robot domain
+ * - Publisher/Subscriber initialized on a given factory
+ * - Shared ReceiveThread versus one listener thread per subscriber
+ * - One domain per robot versus one shared domain with a partition per robot
+ *
+ * Robots are simulated in-process: a simulator thread publishes LowState at
+ * 500Hz on every robot domain, so no robot is required. For each added robot
+ * the resident memory, thread count and process CPU usage are printed.
+ *
+ * Usage: ./multi_robot_benchmark [robots=10] [--shared] [--partitions] [--base-domain N]
+ */
+
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <igris_sdk/channel_factory.hpp>
+#include <igris_sdk/igris_c_client.hpp>
+#include <igris_sdk/publisher.hpp>
+#include <igris_sdk/receive_thread.hpp>
+#include <igris_sdk/subscriber.hpp>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <sys/resource.h>
+#include <thread>
+#include <unistd.h>
+#include <vector>
+
+using namespace igris_sdk;
+using namespace igris_c::msg::dds;
+
+struct Robot {
+    std::unique_ptr<ChannelFactory> factory;
+    std::unique_ptr<Subscriber<LowState>> state_sub;
+    std::unique_ptr<Publisher<LowCmd>> cmd_pub;
+    std::unique_ptr<Publisher<LowState>> sim_pub;  // Simulated robot side
+    std::atomic<uint64_t> received{0};
+};
+
+static double ResidentMb() {
+    std::ifstream statm("/proc/self/statm");
+    long pages = 0, resident = 0;
+    statm >> pages >> resident;
+    return resident * sysconf(_SC_PAGESIZE) / (1024.0 * 1024.0);
+}
+
+static int ThreadCount() {
+    std::ifstream status("/proc/self/status");
+    std::string key;
+    while (status >> key) {
+        if (key == "Threads:") {
+            int n = 0;
+            status >> n;
+            return n;
+        }
+    }
+    return 0;
+}
+
+static double CpuSeconds() {
+    rusage usage{};
+    getrusage(RUSAGE_SELF, &usage);
+    return usage.ru_utime.tv_sec + usage.ru_stime.tv_sec + (usage.ru_utime.tv_usec + usage.ru_stime.tv_usec) / 1e6;
+}
+
+int main(int argc, char **argv) {
+    int num_robots  = 10;
+    int base_domain = 10;
+    bool shared     = false;
+    bool partitions = false;
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        if (arg == "--shared") {
+            shared = true;
+        } else if (arg == "--partitions") {
+            partitions = true;
+        } else if (arg == "--base-domain" && i + 1 < argc) {
+            base_domain = std::atoi(argv[++i]);
+        } else {
+            num_robots = std::atoi(argv[i]);
+        }
+    }
+
+    std::cout << "=== IGRIS SDK Multi-Robot Benchmark ===" << std::endl;
+    if (partitions) {
+        std::cout << "Robots: " << num_robots << " (domain " << base_domain << ", partitions robot0-robot" << num_robots - 1 << ")" << std::endl;
+    } else {
+        std::cout << "Robots: " << num_robots << " (domains " << base_domain << "-" << base_domain + num_robots - 1 << ")" << std::endl;
+    }
+    std::cout << "Receive: " << (shared ? "shared ReceiveThread" : "listener thread per subscriber") << std::endl;
+
+    std::vector<std::unique_ptr<Robot>> robots;
+    std::mutex robots_mutex;
+    ReceiveThread receiver;
+    if (shared) receiver.start();
+
+    // Simulator: LowState at 500Hz on every robot domain
+    std::atomic<bool> running(true);
+    std::thread simulator([&] {
+        LowState state;
+        auto next = std::chrono::steady_clock::now();
+        for (uint32_t tick = 0; running; tick++) {
+            state.tick(tick);
+            {
+                std::lock_guard<std::mutex> lock(robots_mutex);
+                for (auto &robot : robots) robot->sim_pub->write(state);
+            }
+            next += std::chrono::microseconds(2000);
+            std::this_thread::sleep_until(next);
+        }
+    });
+
+    const double base_rss = ResidentMb();
+    std::cout << "\n" << std::setw(7) << "robots" << std::setw(12) << "RSS [MB]" << std::setw(14) << "MB/robot" << std::setw(10)
+              << "threads" << std::setw(12) << "CPU [%]" << std::setw(14) << "CPU/robot" << std::setw(12) << "rx [Hz]" << std::endl;
+
+    for (int k = 0; k < num_robots; k++) {
+        auto robot     = std::make_unique<Robot>();
+        robot->factory = std::make_unique<ChannelFactory>();
+        if (partitions) {
+            robot->factory->Init(base_domain);
+            robot->factory->SetPartition("robot" + std::to_string(k));
+        } else {
+            robot->factory->Init(base_domain + k);
+        }
+
+        Robot *r         = robot.get();
+        robot->state_sub = std::make_unique<Subscriber<LowState>>("rt/lowstate");
+        robot->cmd_pub   = std::make_unique<Publisher<LowCmd>>("rt/lowcmd");
+        robot->sim_pub   = std::make_unique<Publisher<LowState>>("rt/lowstate");
+        bool ok          = robot->state_sub->init(*robot->factory, [r](const LowState &) { r->received++; }, !shared);
+        ok               = ok && robot->cmd_pub->init(*robot->factory) && robot->sim_pub->init(*robot->factory);
+        if (ok && shared) ok = receiver.add(*robot->state_sub);
+        if (!ok) {
+            std::cerr << "Failed to set up robot " << k << std::endl;
+            break;
+        }
+        {
+            std::lock_guard<std::mutex> lock(robots_mutex);
+            robots.push_back(std::move(robot));
+        }
+
+        // Let discovery settle, then measure one second
+        std::this_thread::sleep_for(std::chrono::milliseconds(500));
+        uint64_t rx0 = 0;
+        for (auto &rb : robots) rx0 += rb->received;
+        double cpu0 = CpuSeconds();
+        auto t0     = std::chrono::steady_clock::now();
+        std::this_thread::sleep_for(std::chrono::seconds(1));
+        double wall = std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+        double cpu  = 100.0 * (CpuSeconds() - cpu0) / wall;
+        uint64_t rx = 0;
+        for (auto &rb : robots) rx += rb->received;
+
+        int n      = static_cast<int>(robots.size());
+        double rss = ResidentMb();
+        std::cout << std::fixed << std::setprecision(1) << std::setw(7) << n << std::setw(12) << rss << std::setw(14) << (rss - base_rss) / n
+                  << std::setw(10) << ThreadCount() << std::setw(12) << cpu << std::setw(14) << cpu / n << std::setw(12)
+                  << (rx - rx0) / wall << std::endl;
+    }
+
+    running = false;
+    simulator.join();
+    receiver.stop();
+    return 0;
+}
@@ -20,6 +20,7 @@
 #include <future>
 #include <igris_sdk/channel_factory.hpp>
 #include <igris_sdk/igris_c_client.hpp>
+#include <igris_sdk/joint_limits.hpp>
 #include <igris_sdk/publisher.hpp>
 #include <igris_sdk/subscriber.hpp>
 #include <iostream>
@@ -50,48 +51,6 @@ static const std::array<const char *, 31> JOINT_NAMES = {
     "Wrist_Pitch_L", "Shoulder_Pitch_R", "Shoulder_Roll_R", "Shoulder_Yaw_R", "Elbow_Pitch_R", "Wrist_Yaw_R",  "Wrist_Roll_R",
     "Wrist_Pitch_R", "Neck_Yaw",         "Neck_Pitch"};
 
-// Joint position limits (rad) from params.yaml
-static const std::array<float, 31> JOINT_POS_MAX = {
-    1.57f,                                                   // Waist_Yaw
-    0.310f, 0.28f,                                           // Waist_Roll, Waist_Pitch
-    0.480f, 2.300f, 1.570f, 2.280f, 0.698f, 0.349f,          // Left leg
-    0.480f, 0.330f, 1.570f, 2.280f, 0.698f, 0.349f,          // Right leg
-    1.047f, 3.140f, 1.570f, 0.0f,   1.570f, 0.870f, 0.650f,  // Left arm
-    1.047f, 0.170f, 1.570f, 0.0f,   1.570f, 1.221f, 0.650f,  // Right arm
-    1.221f, 0.520f                                           // Neck
-};
-
-static const std::array<float, 31> JOINT_POS_MIN = {
-    -1.57f,                                                       // Waist_Yaw
-    -0.310f, -0.87f,                                              // Waist_Roll, Waist_Pitch
-    -2.000f, -0.330f, -1.570f, 0.0f,  -0.70f,  -0.350f,           // Left leg
-    -2.000f, -2.300f, -1.570f, 0.0f,  -0.70f,  -0.350f,           // Right leg
-    -3.141f, -0.170f, -1.570f, -2.0f, -1.570f, -1.221f, -0.650f,  // Left arm
-    -3.141f, -3.140f, -1.570f, -2.0f, -1.570f, -0.870f, -0.650f,  // Right arm
-    -1.221f, -0.520f                                              // Neck
-};
-
-// Motor position limits (rad) from params.yaml
-static const std::array<float, 31> MOTOR_POS_MAX = {
-    1.57f,                                                  // Waist_Yaw
-    0.87f,  0.87f,                                          // Waist_L, Waist_R
-    0.480f, 2.300f, 1.570f, 2.280f, 0.609f, 0.523f,         // Left leg
-    0.480f, 0.330f, 1.570f, 2.280f, 0.609f, 0.523f,         // Right leg
-    1.047f, 3.140f, 1.570f, 0.0f,   1.570f, 0.75f,  0.75f,  // Left arm
-    1.047f, 0.170f, 1.570f, 0.0f,   1.570f, 0.98f,  0.98f,  // Right arm
-    1.221f, 0.520f                                          // Neck
-};
-
-static const std::array<float, 31> MOTOR_POS_MIN = {
-    -1.57f,                                                      // Waist_Yaw
-    -0.34f,  -0.34f,                                             // Waist_L, Waist_R
-    -2.000f, -0.330f, -1.570f, 0.0f,  -0.630f, -0.617f,          // Left leg
-    -2.000f, -2.300f, -1.570f, 0.0f,  -0.630f, -0.617f,          // Right leg
-    -3.141f, -0.170f, -1.570f, -2.0f, -1.570f, -0.98f,  -0.98f,  // Left arm
-    -3.141f, -3.140f, -1.570f, -2.0f, -1.570f, -0.75f,  -0.75f,  // Right arm
-    -1.221f, -0.520f                                             // Neck
-};
-
 // Global state
 static std::atomic<bool> g_running(true);
 static std::atomic<uint32_t> g_lowstate_received_count(0);
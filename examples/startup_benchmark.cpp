@@ -0,0 +1,155 @@
+/**
+ * @file startup_benchmark.cpp
+ * @brief Time from process start to the first LowState callback
+ *
+ * This example measures each startup phase against a running robot:
+ * - DDS participant creation (ChannelFactory or FastStartDiscovery)
+ * - Discovery: robot's LowState writer and LowCmd reader matched
+ * - First LowState callback
+ *
+ * Without peer addresses the default discovery (multicast SPDP) is used; with
+ * addresses, FastStartDiscovery sends unicast SPDP to them. Run both to compare.
+ *
+ * Usage: ./startup_benchmark [domain_id] [robot_address ...] [--peers-file <file>]
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <igris_sdk/channel_factory.hpp>
+#include <igris_sdk/fast_start.hpp>
+#include <igris_sdk/igris_c_client.hpp>
+#include <igris_sdk/publisher.hpp>
+#include <igris_sdk/subscriber.hpp>
+#include <iomanip>
+#include <iostream>
+#include <iterator>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <time.h>
+#include <unistd.h>
+
+using namespace igris_sdk;
+using namespace igris_c::msg::dds;
+using Clock = std::chrono::steady_clock;
+
+static std::atomic<int64_t> g_first_state_ns(0);
+
+static int64_t NowNs() { return std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now().time_since_epoch()).count(); }
+
+// Time since the process was exec'd, from /proc/self/stat (clock-tick resolution, usually 10ms).
+// Returns a negative value if unavailable.
+static double ProcessAgeMs() {
+    std::ifstream stat("/proc/self/stat");
+    std::string content((std::istreambuf_iterator<char>(stat)), std::istreambuf_iterator<char>());
+    size_t pos = content.rfind(')');
+    if (pos == std::string::npos) return -1.0;
+
+    // Field 22 (starttime); fields after the command name start at field 3
+    std::istringstream fields(content.substr(pos + 2));
+    std::string field;
+    for (int i = 3; i < 22; i++) fields >> field;
+    unsigned long long start_ticks = 0;
+    if (!(fields >> start_ticks)) return -1.0;
+
+    timespec boot{};
+    clock_gettime(CLOCK_BOOTTIME, &boot);
+    double now_ms = boot.tv_sec * 1e3 + boot.tv_nsec / 1e6;
+    return now_ms - start_ticks * 1e3 / sysconf(_SC_CLK_TCK);
+}
+
+static void PrintPhase(const char *name, int64_t main_ns, int64_t t_ns, double exec_offset_ms) {
+    double since_main = (t_ns - main_ns) / 1e6;
+    std::cout << "  " << std::left << std::setw(28) << name << std::right << std::fixed << std::setprecision(1) << std::setw(9)
+              << since_main << " ms";
+    if (exec_offset_ms >= 0.0) std::cout << "  (" << std::setw(7) << since_main + exec_offset_ms << " ms since exec)";
+    std::cout << std::endl;
+}
+
+int main(int argc, char **argv) {
+    const int64_t main_ns       = NowNs();
+    const double exec_offset_ms = ProcessAgeMs();
+
+    int domain_id = 0;
+    FastStartConfig fast_config;
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        if (arg == "--peers-file" && i + 1 < argc) {
+            fast_config.peers_file = argv[++i];
+        } else if (i == 1 && std::all_of(arg.begin(), arg.end(), ::isdigit)) {
+            domain_id = std::atoi(argv[i]);
+        } else {
+            fast_config.peers.push_back(arg);
+        }
+    }
+    const bool fast_start = !fast_config.peers.empty() || !fast_config.peers_file.empty();
+
+    std::cout << "=== IGRIS SDK Startup Benchmark ===" << std::endl;
+    std::cout << "Domain ID: " << domain_id << std::endl;
+    std::cout << "Discovery: " << (fast_start ? "fast-start (unicast peers)" : "default (multicast)") << std::endl;
+
+    // Participant
+    FastStartDiscovery discovery(fast_config);
+    if (fast_start) {
+        if (!discovery.init(domain_id)) return 1;
+    } else {
+        ChannelFactory::Instance()->Init(domain_id);
+    }
+    if (!ChannelFactory::Instance()->IsInitialized()) {
+        std::cerr << "Failed to initialize ChannelFactory" << std::endl;
+        return 1;
+    }
+    const int64_t participant_ns = NowNs();
+
+    // Endpoints
+    Subscriber<LowState> state_sub("rt/lowstate");
+    Publisher<LowCmd> cmd_pub("rt/lowcmd");
+    if (!state_sub.init([](const LowState &) {
+            int64_t expected = 0;
+            g_first_state_ns.compare_exchange_strong(expected, NowNs());
+        }) ||
+        !cmd_pub.init()) {
+        std::cerr << "Failed to initialize endpoints" << std::endl;
+        return 1;
+    }
+    const int64_t endpoints_ns = NowNs();
+
+    // Discovery
+    const int timeout_ms = 10000;
+    if (!state_sub.wait_for_publishers(1, timeout_ms)) {
+        std::cerr << "No LowState writer matched within " << timeout_ms << "ms" << std::endl;
+        return 1;
+    }
+    const int64_t writer_matched_ns = NowNs();
+
+    if (!cmd_pub.wait_for_subscribers(1, timeout_ms)) {
+        std::cerr << "No LowCmd reader matched within " << timeout_ms << "ms" << std::endl;
+        return 1;
+    }
+    const int64_t reader_matched_ns = NowNs();
+
+    // First sample: the callback stamps the time, this thread only waits for it
+    const auto deadline = Clock::now() + std::chrono::milliseconds(timeout_ms);
+    while (g_first_state_ns.load() == 0 && Clock::now() < deadline) {
+        state_sub.wait_for_first_sample(10);
+    }
+    if (g_first_state_ns.load() == 0) {
+        std::cerr << "No LowState received within " << timeout_ms << "ms" << std::endl;
+        return 1;
+    }
+
+    if (fast_start) discovery.save_peers();
+
+    std::cout << "\nStartup phases (since main()):" << std::endl;
+    PrintPhase("Participant created", main_ns, participant_ns, exec_offset_ms);
+    PrintPhase("Endpoints created", main_ns, endpoints_ns, exec_offset_ms);
+    PrintPhase("LowState writer matched", main_ns, writer_matched_ns, exec_offset_ms);
+    PrintPhase("LowCmd reader matched", main_ns, reader_matched_ns, exec_offset_ms);
+    PrintPhase("First LowState callback", main_ns, g_first_state_ns.load(), exec_offset_ms);
+
+    state_sub.stop();
+    return 0;
+}
@@ -0,0 +1,181 @@
+#pragma once
+
+#include "igris_sdk/igris_c_client.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <future>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace igris_sdk {
+
+/**
+ * @brief Callback-based service calls on top of IgrisC_Client
+ *
+ * Each call sends its request through the client's *Async() API and returns
+ * immediately. A single completion thread watches all outstanding requests and
+ * invokes the callback exactly once, with the response or with a failed
+ * "Request timeout" response after timeout_ms. If the response future holds an
+exception (e.g. a broken promise), the callback gets a failed response carrying
+its message instead. Callbacks run on the completion
+ * thread without any internal lock held, so they may take an interpreter lock
+ * and hand the result to an event loop (e.g. asyncio's loop.call_soon_threadsafe),
+ * and calls to several clients can be outstanding at the same time.
+ *
+ * The client must outlive this object. A timeout only drops the request here:
+ * IgrisC_Client keeps its promise in bms_init_promises_ / torque_promises_ /
+ * control_mode_promises_ until a response with that request id arrives, so
+ * requests the robot never answers stay there for the client's lifetime.
+ *
+ * Example:
+ * @code
+ * IgrisC_Client client;
+ * client.Init();
+ * AsyncServiceClient async_client(client);
+ * async_client.SetTorque(TorqueType::TORQUE_ON, [](const ServiceResponse &res) {
+ *     std::cout << (res.success() ? "SUCCESS" : "FAILED") << " - " << res.message() << std::endl;
+ * });
+ * @endcode
+ */
+class AsyncServiceClient {
+  public:
+    using Callback = std::function<void(const igris_c::msg::dds::ServiceResponse &res)>;
+
+    explicit AsyncServiceClient(IgrisC_Client &client) : client_(client) {}
+
+    // Outstanding requests are completed with a timeout response
+    ~AsyncServiceClient();
+
+    AsyncServiceClient(const AsyncServiceClient &)            = delete;
+    AsyncServiceClient &operator=(const AsyncServiceClient &) = delete;
+
+    void InitBms(igris_c::msg::dds::BmsInitType init_type, Callback callback, int timeout_ms = 5000) {
+        track(client_.InitBmsAsync(init_type), std::move(callback), timeout_ms);
+    }
+
+    void SetTorque(igris_c::msg::dds::TorqueType torque, Callback callback, int timeout_ms = 5000) {
+        track(client_.SetTorqueAsync(torque), std::move(callback), timeout_ms);
+    }
+
+    void SetControlMode(igris_c::msg::dds::ControlMode mode, Callback callback, int timeout_ms = 5000) {
+        track(client_.SetControlModeAsync(mode), std::move(callback), timeout_ms);
+    }
+
+    // Requests whose callback has not run yet
+    size_t pending() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return calls_.size();
+    }
+
+  private:
+    struct Call {
+        std::future<igris_c::msg::dds::ServiceResponse> future;
+        std::chrono::steady_clock::time_point deadline;
+        Callback callback;
+    };
+
+    static igris_c::msg::dds::ServiceResponse timeout_response() {
+        igris_c::msg::dds::ServiceResponse res;
+        res.success(false);
+        res.message("Request timeout");
+        return res;
+    }
+
+    // Response of a ready future; a stored exception becomes a failed response
+    static igris_c::msg::dds::ServiceResponse take_response(std::future<igris_c::msg::dds::ServiceResponse> &future) {
+        igris_c::msg::dds::ServiceResponse res;
+        try {
+            return future.get();
+        } catch (const std::exception &e) {
+            res.message(std::string("Request failed: ") + e.what());
+        } catch (...) {
+            res.message("Request failed");
+        }
+        res.success(false);
+        return res;
+    }
+
+    void track(std::future<igris_c::msg::dds::ServiceResponse> future, Callback callback, int timeout_ms);
+    void run();
+
+    IgrisC_Client &client_;
+
+    mutable std::mutex mutex_;
+    std::condition_variable cv_;
+    std::vector<Call> calls_;
+    std::thread thread_;
+    bool running_ = false;
+};
+
+inline AsyncServiceClient::~AsyncServiceClient() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        running_ = false;
+    }
+    cv_.notify_one();
+    if (thread_.joinable()) thread_.join();
+    for (Call &call : calls_) {
+        if (call.callback) call.callback(timeout_response());
+    }
+}
+
+inline void AsyncServiceClient::track(std::future<igris_c::msg::dds::ServiceResponse> future, Callback callback, int timeout_ms) {
+    Call call{std::move(future), std::chrono::steady_clock::now() + std::chrono::milliseconds(timeout_ms), std::move(callback)};
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        calls_.push_back(std::move(call));
+        if (!running_) {
+            // Completion thread is started on the first request
+            if (thread_.joinable()) thread_.join();
+            running_ = true;
+            thread_  = std::thread(&AsyncServiceClient::run, this);
+        }
+    }
+    cv_.notify_one();
+}
+
+inline void AsyncServiceClient::run() {
+    std::vector<std::pair<Callback, igris_c::msg::dds::ServiceResponse>> done;
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (running_) {
+        auto now = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < calls_.size();) {
+            Call &call = calls_[i];
+            if (call.future.wait_for(std::chrono::seconds(0)) == std::future_status::ready) {
+                done.emplace_back(std::move(call.callback), take_response(call.future));
+            } else if (now >= call.deadline) {
+                done.emplace_back(std::move(call.callback), timeout_response());
+            } else {
+                i++;
+                continue;
+            }
+            calls_[i] = std::move(calls_.back());
+            calls_.pop_back();
+        }
+
+        if (!done.empty()) {
+            lock.unlock();
+            for (auto &d : done) {
+                if (d.first) d.first(d.second);
+            }
+            done.clear();
+            lock.lock();
+            continue;
+        }
+
+        // Responses complete futures from the subscriber threads; poll them every 1ms
+        if (calls_.empty()) {
+            cv_.wait(lock, [this] { return !running_ || !calls_.empty(); });
+        } else {
+            cv_.wait_for(lock, std::chrono::milliseconds(1));
+        }
+    }
+}
+
+}  // namespace igris_sdk
@@ -0,0 +1,190 @@
+#pragma once
+
+#include "igris_sdk/state_ring.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <iostream>
+#include <mutex>
+#include <thread>
+
+namespace igris_sdk {
+
+/**
+ * @brief Configuration for BatchedDelivery
+ */
+struct BatchedDeliveryConfig {
+    size_t ring_capacity    = 4096;   // Samples buffered while the consumer is busy
+    size_t batch_size       = 10;     // Deliver once this many samples are pending...
+    uint32_t max_latency_us = 10000;  // ...or when the oldest pending sample is this old
+};
+
+/**
+ * @brief Delivery counters
+ */
+struct BatchedDeliveryStats {
+    uint64_t received  = 0;  // Samples pushed by the listener
+    uint64_t delivered = 0;  // Samples handed to the batch callback
+    uint64_t batches   = 0;
+    uint64_t dropped   = 0;  // Samples overwritten before the consumer got to them
+};
+
+/**
+ * @brief Decouples a subscriber callback from a slow consumer with batched hand-off
+ *
+ * push() is called on the DDS listener thread and only copies the sample into a
+ * preallocated SoA ring (LowStateRing / LowCmdRing), so the listener keeps draining
+ * DDS whatever the consumer does. A delivery thread hands the consumer all pending
+ * samples at once when batch_size samples are pending or the oldest one has waited
+ * max_latency_us. A binding for an interpreter with a global lock (e.g. Python's
+ * GIL) acquires it once per batch instead of once per sample.
+ *
+ * The callback receives the ring and the range [first, first + count) of sample
+ * sequence numbers; it must finish with that range before returning (copy the
+ * columns with ring.copy()). If the consumer falls more than ring_capacity
+ * samples behind, the oldest samples are skipped and counted as dropped. A
+ * callback that can run longer than the ring covers should check
+ * ring.readable(first) after copying.
+ *
+ * Example:
+ * @code
+ * BatchedDelivery<LowStateRing, LowState> batches;
+ * sub.init([&](const LowState &s) { batches.push(s); });
+ * batches.start([](const LowStateRing &ring, uint64_t first, size_t count) {
+ *     std::vector<float> q(count * 31);
+ *     ring.copy(LowStateField::JointQ, first, count, q.data());
+ * });
+ * @endcode
+ */
+template <typename Ring, typename Message> class BatchedDelivery {
+  public:
+    using BatchCallback = std::function<void(const Ring &ring, uint64_t first, size_t count)>;
+
+    explicit BatchedDelivery(const BatchedDeliveryConfig &config = BatchedDeliveryConfig())
+        : config_(config), ring_(config.ring_capacity) {
+        config_.batch_size = std::clamp<size_t>(config_.batch_size, 1, ring_.capacity() / 2);
+    }
+
+    ~BatchedDelivery() { stop(); }
+
+    BatchedDelivery(const BatchedDelivery &)            = delete;
+    BatchedDelivery &operator=(const BatchedDelivery &) = delete;
+
+    // Start the delivery thread
+    bool start(BatchCallback callback);
+
+    // Stop the delivery thread (pending samples are delivered first)
+    void stop();
+
+    // Listener thread: buffer one sample; never blocks on the consumer
+    void push(const Message &msg) {
+        ring_.push(msg, now_us());
+        uint64_t seq = ring_.sequence();
+        if (seq - next_.load(std::memory_order_relaxed) == config_.batch_size) {
+            cv_.notify_one();
+        }
+    }
+
+    bool is_running() const { return running_.load(std::memory_order_acquire); }
+
+    const Ring &ring() const { return ring_; }
+
+    BatchedDeliveryStats stats() const {
+        BatchedDeliveryStats s;
+        s.received  = ring_.sequence();
+        s.delivered = delivered_.load(std::memory_order_relaxed);
+        s.batches   = batches_.load(std::memory_order_relaxed);
+        s.dropped   = dropped_.load(std::memory_order_relaxed);
+        return s;
+    }
+
+  private:
+    static uint64_t now_us() {
+        return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+
+    void run();
+    void deliver(uint64_t written);
+
+    BatchedDeliveryConfig config_;
+    Ring ring_;
+    BatchCallback callback_;
+
+    std::thread thread_;
+    std::atomic<bool> running_{false};
+    std::mutex mutex_;
+    std::condition_variable cv_;
+
+    std::atomic<uint64_t> next_{0};  // First sample not yet delivered
+    std::atomic<uint64_t> delivered_{0};
+    std::atomic<uint64_t> batches_{0};
+    std::atomic<uint64_t> dropped_{0};
+};
+
+template <typename Ring, typename Message> bool BatchedDelivery<Ring, Message>::start(BatchCallback callback) {
+    if (running_.load(std::memory_order_acquire)) {
+        std::cerr << "[BatchedDelivery] Already running" << std::endl;
+        return false;
+    }
+    callback_ = std::move(callback);
+    running_.store(true, std::memory_order_release);
+    thread_ = std::thread(&BatchedDelivery::run, this);
+    return true;
+}
+
+template <typename Ring, typename Message> void BatchedDelivery<Ring, Message>::stop() {
+    if (!running_.exchange(false, std::memory_order_acq_rel)) return;
+    cv_.notify_one();
+    if (thread_.joinable()) thread_.join();
+}
+
+template <typename Ring, typename Message> void BatchedDelivery<Ring, Message>::deliver(uint64_t written) {
+    uint64_t first = next_.load(std::memory_order_relaxed);
+
+    // Keep one slot of headroom: the listener may be writing the slot after `written`
+    const uint64_t window = ring_.capacity() - 1;
+    if (written - first > window) {
+        dropped_.fetch_add(written - window - first, std::memory_order_relaxed);
+        first = written - window;
+    }
+    size_t count = static_cast<size_t>(written - first);
+    if (count == 0) return;
+
+    callback_(ring_, first, count);
+    next_.store(written, std::memory_order_relaxed);
+    delivered_.fetch_add(count, std::memory_order_relaxed);
+    batches_.fetch_add(1, std::memory_order_relaxed);
+}
+
+template <typename Ring, typename Message> void BatchedDelivery<Ring, Message>::run() {
+    const auto max_wait = std::chrono::microseconds(config_.max_latency_us);
+    while (running_.load(std::memory_order_acquire)) {
+        uint64_t written = ring_.sequence();
+        uint64_t pending = written - next_.load(std::memory_order_relaxed);
+        if (pending >= config_.batch_size) {
+            deliver(written);
+            continue;
+        }
+
+        // Wait for a full batch, or until the oldest pending sample hits max_latency_us
+        auto timeout = max_wait;
+        if (pending > 0) {
+            uint64_t oldest_us = *ring_.template at<uint64_t>(Ring::HOST_TIME, written - pending);
+            uint64_t age_us    = now_us() - oldest_us;
+            if (age_us >= config_.max_latency_us) {
+                deliver(written);
+                continue;
+            }
+            timeout = std::chrono::microseconds(config_.max_latency_us - age_us);
+        }
+        std::unique_lock<std::mutex> lock(mutex_);
+        cv_.wait_for(lock, timeout);
+    }
+    deliver(ring_.sequence());
+}
+
+}  // namespace igris_sdk
@@ -0,0 +1,107 @@
+#pragma once
+
+#include "igris_sdk/types.hpp"
+
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <functional>
+#include <type_traits>
+#include <utility>
+
+namespace igris_sdk {
+
+namespace detail {
+
+template <typename T, typename = void> struct has_tick : std::false_type {};
+template <typename T> struct has_tick<T, decltype(std::declval<T &>().tick(uint32_t()), void())> : std::true_type {};
+
+// Generated operator==, ignoring tick (which differs in every sample of the state topics)
+template <typename T> bool equal_except_tick(const T &a, const T &b, std::true_type) {
+    T tmp = a;
+    tmp.tick(b.tick());
+    return tmp == b;
+}
+template <typename T> bool equal_except_tick(const T &a, const T &b, std::false_type) { return a == b; }
+template <typename T> bool equal_except_tick(const T &a, const T &b) { return equal_except_tick(a, b, has_tick<T>()); }
+
+}  // namespace detail
+
+/**
+ * @brief Change detection for slowly changing topics
+ *
+ * apply(msg) returns true if msg should be published or delivered: the first
+ * message, a message that changed, or an unchanged one once keepalive_s has
+ * passed since the last accepted message. By default a change is any difference
+ * under the generated operator== except tick; a predicate can implement a
+ * deadband instead (see bms_state_deadband()).
+ *
+ * The keepalive lets endpoints that join later (and the robot's own liveliness
+ * checks) still see the value; keepalive_s = 0 disables it.
+ *
+ * Plugs into Publisher<T>::write(msg, filter).
+ *
+ * Example:
+ * @code
+ * ChangeFilter<BmsState> filter(1.0, bms_state_deadband(0.1f));
+ * publisher.write(state, filter);  // written only on change, at least once per second
+ * @endcode
+ */
+template <typename T> class ChangeFilter {
+  public:
+    // true if msg differs enough from last
+    using Predicate = std::function<bool(const T &last, const T &msg)>;
+
+    explicit ChangeFilter(double keepalive_s = 1.0, Predicate changed = nullptr)
+        : keepalive_(std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(keepalive_s))), changed_(std::move(changed)) {}
+
+    bool apply(const T &msg) {
+        const auto now = Clock::now();
+        if (has_last_ && !changed(msg)) {
+            if (keepalive_ <= Clock::duration::zero() || now - last_time_ < keepalive_) {
+                suppressed_++;
+                return false;
+            }
+        }
+        last_      = msg;
+        last_time_ = now;
+        has_last_  = true;
+        return true;
+    }
+
+    // Whether msg differs from the last accepted message (true if there is none)
+    bool changed(const T &msg) const {
+        if (!has_last_) return true;
+        return changed_ ? changed_(last_, msg) : !detail::equal_except_tick(last_, msg);
+    }
+
+    // Forget the last message; the next one is accepted
+    void reset() { has_last_ = false; }
+
+    // Last accepted message (valid once apply() has returned true)
+    const T &last() const { return last_; }
+
+    // Messages rejected as unchanged
+    uint64_t suppressed() const { return suppressed_; }
+
+  private:
+    using Clock = std::chrono::steady_clock;
+
+    Clock::duration keepalive_;
+    Predicate changed_;
+    T last_{};
+    Clock::time_point last_time_{};
+    bool has_last_       = false;
+    uint64_t suppressed_ = 0;
+};
+
+// BmsState change predicate: any relay/e-stop/connection/init state change, or battery moved by more than battery_deadband
+inline ChangeFilter<BmsState>::Predicate bms_state_deadband(float battery_deadband) {
+    return [battery_deadband](const BmsState &last, const BmsState &msg) {
+        return last.body_power() != msg.body_power() || last.legs_power() != msg.legs_power() || last.estop() != msg.estop() ||
+               last.connect() != msg.connect() || last.bms_init_state() != msg.bms_init_state() ||
+               std::fabs(last.battery() - msg.battery()) > battery_deadband;
+    };
+}
+
+}  // namespace igris_sdk
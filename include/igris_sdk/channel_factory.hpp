@@ -1,6 +1,8 @@
 #pragma once
 
 #include <dds/dds.hpp>
+#include <iostream>
+#include <map>
 #include <memory>
 #include <mutex>
 #include <string>
@@ -49,6 +51,32 @@ class ChannelFactory {
      */
     void Release();
 
+    /**
+     * @brief Set the DDS partition of endpoints created through this factory
+     *
+     * Applies to Publisher<T>::init(factory), Subscriber<T>::init(factory, ...) and
+     * IgrisC_Client::Init(factory) called afterwards. Endpoints only match peers in
+     * the same partition, so several robots can share one domain and each robot's
+     * data is filtered during discovery instead of after deserialization. The
+     * robot side must publish in the same partition; a wildcard such as "robot*"
+     * matches all robots (e.g. for a fleet monitor).
+     *
+     * The factory-less Publisher<T>::init(), Subscriber<T>::init(callback) and
+     * IgrisC_Client::Init() of the built-in message types run library code that
+     * predates partitions and ignore this setting, even on Instance(). Pass the
+     * factory explicitly (e.g. init(*ChannelFactory::Instance())); a warning is
+     * logged when a partition is set on the singleton.
+     *
+     * @param partition Partition name ("" for the default partition)
+     * @return false if the factory is not initialized
+     */
+    bool SetPartition(const std::string &partition);
+
+    /**
+     * @brief Partition set with SetPartition() ("" if none)
+     */
+    std::string GetPartition();
+
     // Delete copy/move constructors
     ChannelFactory(const ChannelFactory &)            = delete;
     ChannelFactory &operator=(const ChannelFactory &) = delete;
@@ -69,4 +97,52 @@ class ChannelFactory {
     std::mutex participant_mutex_;
 };
 
+namespace detail {
+
+// Per-factory settings kept outside ChannelFactory (its layout is fixed by the library).
+// Entries are tied to the factory's participant, so they end with Release() or destruction.
+struct FactorySettings {
+    std::weak_ptr<dds::domain::DomainParticipant> participant;
+    std::string partition;
+};
+
+inline std::map<const ChannelFactory *, FactorySettings> &factory_settings(std::unique_lock<std::mutex> &lock) {
+    static std::mutex mutex;
+    static std::map<const ChannelFactory *, FactorySettings> settings;
+    lock = std::unique_lock<std::mutex>(mutex);
+    return settings;
+}
+
+}  // namespace detail
+
+inline bool ChannelFactory::SetPartition(const std::string &partition) {
+    auto participant = GetParticipant();
+    if (!participant) return false;
+
+    if (!partition.empty() && this == Instance()) {
+        std::cerr << "[ChannelFactory] Partition \"" << partition << "\" is ignored by the built-in types' init() and IgrisC_Client::Init(); "
+                  << "use the init(factory) / Init(factory) overloads" << std::endl;
+    }
+
+    std::unique_lock<std::mutex> lock;
+    auto &settings = detail::factory_settings(lock);
+    settings[this] = {participant, partition};
+    return true;
+}
+
+inline std::string ChannelFactory::GetPartition() {
+    auto participant = GetParticipant();
+
+    std::unique_lock<std::mutex> lock;
+    auto &settings = detail::factory_settings(lock);
+    auto it        = settings.find(this);
+    if (it == settings.end()) return "";
+    if (!participant || it->second.participant.lock() != participant) {
+        // Set for an earlier participant (factory released or destroyed)
+        settings.erase(it);
+        return "";
+    }
+    return it->second.partition;
+}
+
 }  // namespace igris_sdk
@@ -0,0 +1,293 @@
+#pragma once
+
+#include "igris_sdk/types.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+namespace igris_sdk {
+
+/**
+ * @brief Configuration for ClockSync
+ */
+struct ClockSyncConfig {
+    size_t window          = 512;   // Fit samples kept for the regression (ring buffer)
+    size_t decimation      = 20;    // Once synced, keep the lowest-delay sample out of every N
+    size_t min_samples     = 16;    // Fit samples required before is_synced() becomes true
+    double inlier_fraction = 0.25;  // Lowest-delay fraction of the window used for the final fit
+    double latency_alpha   = 0.01;  // EWMA factor for the mean receive latency
+    double base_latency_us = 0.0;   // Known minimum one-way latency (e.g. half a measured round trip)
+};
+
+/**
+ * @brief Snapshot of the current clock mapping
+ */
+struct ClockSyncStats {
+    size_t samples         = 0;  // Samples received since reset()
+    bool synced            = false;
+    double tick_period_us  = 0.0;  // Host microseconds per robot tick
+    double latency_last_us = 0.0;  // Receive latency of the newest sample
+    double latency_mean_us = 0.0;  // Receive latency, exponentially averaged
+    double latency_peak_us = 0.0;  // Worst receive latency since reset()
+};
+
+/**
+ * @brief Maps robot LowState ticks to host monotonic time
+ *
+ * Fits host_receive_us = offset + period * tick over a sliding window. Transport
+ * delay only ever adds to the receive time, so after an ordinary least-squares
+ * pass the line is refitted on the lowest-delay samples only (lower envelope),
+ * which keeps scheduling spikes and bursts from biasing offset and drift.
+ *
+ * Host time is std::chrono::steady_clock (see now_us()); get_timestamp_us() is
+ * wall-clock time and may jump, so do not mix the two.
+ *
+ * Once synced, only the fastest sample of every `decimation` samples enters the
+ * window, so the default 512 x 20 window spans about 10 s at 1 kHz: long enough
+ * to resolve clock drift while the refit cost is paid once per bucket.
+ *
+ * One-way latency cannot be observed without a shared clock: receive latency is
+ * reported relative to the fastest samples in the window, plus base_latency_us.
+ *
+ * Thread-safe: add_sample() is typically called from the Subscriber<LowState>
+ * callback and the queries from the control thread.
+ *
+ * Example:
+ * @code
+ * ClockSync sync;
+ * Subscriber<LowState> sub("rt/lowstate");
+ * sub.init([&](const LowState &s) { sync.add_sample(s); });
+ * ...
+ * uint64_t t_host = sync.tick_to_host_time(state.tick());
+ * @endcode
+ */
+class ClockSync {
+  public:
+    explicit ClockSync(const ClockSyncConfig &config = ClockSyncConfig()) : config_(config) {
+        config_.window      = std::max<size_t>(config_.window, 2);
+        config_.decimation  = std::max<size_t>(config_.decimation, 1);
+        config_.min_samples = std::clamp<size_t>(config_.min_samples, 2, config_.window);
+        ticks_.resize(config_.window);
+        host_.resize(config_.window);
+        residual_.resize(config_.window);
+        sorted_.resize(config_.window);
+    }
+
+    // Host monotonic time in microseconds (the time base used by this class)
+    static uint64_t now_us() {
+        return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+
+    // Add a (robot tick, host receive time) pair
+    void add_sample(uint32_t tick, uint64_t host_receive_us);
+
+    // Add a LowState received just now
+    void add_sample(const LowState &state) { add_sample(state.tick(), now_us()); }
+
+    // True once enough samples with distinct ticks have been fitted
+    bool is_synced() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return synced_;
+    }
+
+    // Host time (us, steady clock) at which the robot produced `tick`; 0 until synced
+    uint64_t tick_to_host_time(uint32_t tick) const;
+
+    // Robot tick corresponding to a host time (us, steady clock); 0 until synced
+    uint32_t host_time_to_tick(uint64_t host_us) const;
+
+    // Mean receive latency in microseconds
+    double receive_latency_us() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return stats_.latency_mean_us;
+    }
+
+    // Estimated host microseconds per robot tick
+    double tick_period_us() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return stats_.tick_period_us;
+    }
+
+    ClockSyncStats stats() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return stats_;
+    }
+
+    // Update the known minimum one-way latency (e.g. from a round-trip measurement)
+    void set_base_latency_us(double us) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        config_.base_latency_us = us;
+    }
+
+    // Forget all samples (e.g. after the robot restarts and its tick resets)
+    void reset() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        count_ = head_ = bucket_n_ = 0;
+        have_tick_                 = false;
+        synced_                    = false;
+        stats_                     = ClockSyncStats();
+    }
+
+  private:
+    int64_t unwrap_near(uint32_t tick, int64_t ref) const { return ref + static_cast<int32_t>(tick - static_cast<uint32_t>(ref)); }
+
+    // Residual of (tick, host) against the published mapping
+    double excess_us(int64_t tick, uint64_t host) const {
+        double x = static_cast<double>(tick - map_tick_);
+        double y = static_cast<double>(static_cast<int64_t>(host - map_host_));
+        return y - (offset_ + period_ * x);
+    }
+
+    void push(int64_t tick, uint64_t host);
+    void refit();
+    // Least-squares fit over window samples whose residual_ is <= max_residual
+    bool fit(int64_t ref_tick, uint64_t ref_host, double max_residual, double &offset, double &period) const;
+
+    ClockSyncConfig config_;
+
+    // Ring buffer of unwrapped ticks and host times (preallocated)
+    std::vector<int64_t> ticks_;
+    std::vector<uint64_t> host_;
+    std::vector<double> residual_;
+    std::vector<double> sorted_;
+    size_t count_ = 0;
+    size_t head_  = 0;
+
+    // Lowest-delay candidate of the current decimation bucket
+    size_t bucket_n_        = 0;
+    int64_t bucket_tick_    = 0;
+    uint64_t bucket_host_   = 0;
+    double bucket_residual_ = 0.0;
+
+    bool have_tick_    = false;
+    int64_t last_tick_ = 0;
+
+    // Published mapping: host = map_host_ + offset_ + period_ * (tick - map_tick_)
+    bool synced_       = false;
+    int64_t map_tick_  = 0;
+    uint64_t map_host_ = 0;
+    double offset_     = 0.0;
+    double period_     = 0.0;
+    ClockSyncStats stats_;
+
+    mutable std::mutex mutex_;
+};
+
+inline bool ClockSync::fit(int64_t ref_tick, uint64_t ref_host, double max_residual, double &offset, double &period) const {
+    double n = 0, sx = 0, sy = 0, sxx = 0, sxy = 0;
+    for (size_t i = 0; i < count_; i++) {
+        if (residual_[i] > max_residual) continue;
+        double x = static_cast<double>(ticks_[i] - ref_tick);
+        double y = static_cast<double>(static_cast<int64_t>(host_[i] - ref_host));
+        n += 1;
+        sx += x;
+        sy += y;
+        sxx += x * x;
+        sxy += x * y;
+    }
+    double den = n * sxx - sx * sx;
+    if (n < 2 || den <= 0.0) return false;
+    period = (n * sxy - sx * sy) / den;
+    offset = (sy - period * sx) / n;
+    return true;
+}
+
+inline void ClockSync::push(int64_t tick, uint64_t host) {
+    ticks_[head_] = tick;
+    host_[head_]  = host;
+    head_         = (head_ + 1) % config_.window;
+    count_        = std::min(count_ + 1, config_.window);
+}
+
+inline void ClockSync::refit() {
+    if (count_ < config_.min_samples) return;
+
+    // Newest fit sample as origin keeps the doubles well conditioned
+    size_t newest     = (head_ + config_.window - 1) % config_.window;
+    int64_t ref_tick  = ticks_[newest];
+    uint64_t ref_host = host_[newest];
+
+    // Pass 1: ordinary least squares over the whole window
+    std::fill(residual_.begin(), residual_.begin() + count_, 0.0);
+    double offset, period;
+    if (!fit(ref_tick, ref_host, HUGE_VAL, offset, period)) return;
+
+    // Pass 2: refit on the lowest-delay samples (lower envelope)
+    for (size_t i = 0; i < count_; i++) {
+        double x     = static_cast<double>(ticks_[i] - ref_tick);
+        double y     = static_cast<double>(static_cast<int64_t>(host_[i] - ref_host));
+        residual_[i] = y - (offset + period * x);
+    }
+    std::copy(residual_.begin(), residual_.begin() + count_, sorted_.begin());
+    size_t k = std::min(count_ - 1, static_cast<size_t>(config_.inlier_fraction * static_cast<double>(count_)));
+    std::nth_element(sorted_.begin(), sorted_.begin() + k, sorted_.begin() + count_);
+    double refit_offset, refit_period;
+    if (fit(ref_tick, ref_host, sorted_[k], refit_offset, refit_period)) {
+        offset = refit_offset;
+        period = refit_period;
+    }
+    if (period <= 0.0) return;
+
+    map_tick_             = ref_tick;
+    map_host_             = ref_host;
+    offset_               = offset;
+    period_               = period;
+    synced_               = true;
+    stats_.synced         = true;
+    stats_.tick_period_us = period;
+}
+
+inline void ClockSync::add_sample(uint32_t tick, uint64_t host_receive_us) {
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    int64_t t  = have_tick_ ? unwrap_near(tick, last_tick_) : static_cast<int64_t>(tick);
+    last_tick_ = t;
+    have_tick_ = true;
+    stats_.samples++;
+
+    if (!synced_) {
+        push(t, host_receive_us);
+        refit();
+        return;
+    }
+
+    // Latency relative to the envelope; samples below it count as zero
+    double residual = excess_us(t, host_receive_us);
+    double latency  = std::max(0.0, residual) + config_.base_latency_us;
+    stats_.latency_last_us = latency;
+    stats_.latency_mean_us += config_.latency_alpha * (latency - stats_.latency_mean_us);
+    stats_.latency_peak_us = std::max(stats_.latency_peak_us, latency);
+
+    // Keep only the fastest sample of each bucket: it carries the least transport noise
+    if (bucket_n_ == 0 || residual < bucket_residual_) {
+        bucket_tick_     = t;
+        bucket_host_     = host_receive_us;
+        bucket_residual_ = residual;
+    }
+    if (++bucket_n_ >= config_.decimation) {
+        bucket_n_ = 0;
+        push(bucket_tick_, bucket_host_);
+        refit();
+    }
+}
+
+inline uint64_t ClockSync::tick_to_host_time(uint32_t tick) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!synced_) return 0;
+    double x   = static_cast<double>(unwrap_near(tick, map_tick_) - map_tick_);
+    double rel = offset_ + period_ * x - config_.base_latency_us;
+    return map_host_ + static_cast<int64_t>(std::llround(rel));
+}
+
+inline uint32_t ClockSync::host_time_to_tick(uint64_t host_us) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!synced_) return 0;
+    double y = static_cast<double>(static_cast<int64_t>(host_us - map_host_)) + config_.base_latency_us;
+    return static_cast<uint32_t>(map_tick_ + std::llround((y - offset_) / period_));
+}
+
+}  // namespace igris_sdk
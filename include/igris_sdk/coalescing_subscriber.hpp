@@ -0,0 +1,140 @@
+#pragma once
+
+#include "igris_sdk/change_filter.hpp"
+#include "igris_sdk/channel_factory.hpp"
+#include "igris_sdk/subscriber.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <iostream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+
+namespace igris_sdk {
+
+/**
+ * @brief Subscriber that delivers only changes, or the latest value per interval
+ *
+ * For slowly changing state topics (BmsState, ControlModeState) where every
+ * sample is a full copy of a value that rarely changes:
+ * - interval_ms > 0: samples are taken once per interval on this class's own
+ *   thread (instead of the listener's 1ms polling) and only the latest one of
+ *   the interval is delivered
+ * - changes_only: samples equal to the last delivered one (ChangeFilter,
+ *   ignoring tick, or the given predicate) are not delivered
+ *
+ * With interval_ms = 0 and changes_only, samples are delivered on the listener
+ * thread as they arrive, skipping unchanged ones.
+ *
+ * Example:
+ * @code
+ * CoalescingSubscriber<ControlModeState> mode_sub("rt/controlmodestate", 200);
+ * mode_sub.init([](const ControlModeState &state) { update_dashboard(state); });
+ * @endcode
+ */
+template <typename MessageType> class CoalescingSubscriber {
+  public:
+    using CallbackType = typename Subscriber<MessageType>::CallbackType;
+    using Predicate    = typename ChangeFilter<MessageType>::Predicate;
+
+    CoalescingSubscriber(const std::string &topic_name, int interval_ms = 100, bool changes_only = true, Predicate changed = nullptr)
+        : sub_(topic_name), interval_ms_(interval_ms), changes_only_(changes_only), filter_(0.0, std::move(changed)) {}
+    ~CoalescingSubscriber() { stop(); }
+
+    CoalescingSubscriber(const CoalescingSubscriber &)            = delete;
+    CoalescingSubscriber &operator=(const CoalescingSubscriber &) = delete;
+
+    bool init(CallbackType callback) { return init(*ChannelFactory::Instance(), std::move(callback)); }
+
+    bool init(ChannelFactory &factory, CallbackType callback) {
+        callback_ = std::move(callback);
+        if (interval_ms_ <= 0) {
+            return sub_.init(factory, [this](const MessageType &msg) {
+                received_++;
+                deliver(msg);
+            });
+        }
+
+        if (!sub_.init(factory, [this](const MessageType &msg) {
+                received_++;
+                latest_  = msg;
+                pending_ = true;
+            },
+                       false)) {
+            return false;
+        }
+        running_ = true;
+        thread_  = std::thread(&CoalescingSubscriber::coalesceThread, this);
+        return true;
+    }
+
+    void stop() {
+        sub_.stop();
+        {
+            std::lock_guard<std::mutex> lock(wake_mutex_);
+            running_ = false;
+        }
+        wake_.notify_all();
+        if (thread_.joinable()) thread_.join();
+    }
+
+    bool is_initialized() const { return sub_.is_initialized(); }
+
+    // Samples received from DDS
+    uint64_t received() const { return received_; }
+
+    // Samples delivered to the callback
+    uint64_t delivered() const { return delivered_; }
+
+    // Underlying subscriber, e.g. for wait_for_publishers()
+    Subscriber<MessageType> &subscriber() { return sub_; }
+
+  private:
+    void deliver(const MessageType &msg) {
+        if (changes_only_ && !filter_.apply(msg)) return;
+        delivered_++;
+        if (callback_) callback_(msg);
+    }
+
+    void coalesceThread() {
+        const auto period = std::chrono::milliseconds(interval_ms_);
+        auto next         = std::chrono::steady_clock::now() + period;
+        while (true) {
+            {
+                std::unique_lock<std::mutex> lock(wake_mutex_);
+                if (wake_.wait_until(lock, next, [this] { return !running_; })) break;
+            }
+            next += period;
+
+            // The callback above keeps only the latest sample of this interval
+            sub_.poll();
+            if (pending_) {
+                pending_ = false;
+                deliver(latest_);
+            }
+        }
+    }
+
+    Subscriber<MessageType> sub_;
+    int interval_ms_;
+    bool changes_only_;
+    ChangeFilter<MessageType> filter_;
+    CallbackType callback_;
+
+    MessageType latest_{};
+    bool pending_ = false;
+
+    std::mutex wake_mutex_;
+    std::condition_variable wake_;
+    std::atomic<bool> running_{false};
+    std::thread thread_;
+
+    std::atomic<uint64_t> received_{0};
+    std::atomic<uint64_t> delivered_{0};
+};
+
+}  // namespace igris_sdk
@@ -0,0 +1,329 @@
+#pragma once
+
+#include "igris_sdk/joint_limits.hpp"
+#include "igris_sdk/joint_math.hpp"
+#include "igris_sdk/types.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+
+namespace igris_sdk {
+
+/**
+ * @brief Limits applied by CommandFilter (per joint, LowCmd index order)
+ *
+ * Use INFINITY to disable a limit.
+ */
+struct CommandFilterConfig {
+    float dt = 0.001f;  // Control period used by apply(cmd) (s)
+
+    JointArray max_velocity     = filled(10.0f);     // |dq| and position slew rate (rad/s)
+    JointArray max_acceleration = filled(200.0f);    // Acceleration and braking of the position slew rate (rad/s^2)
+    JointArray max_tau          = filled(INFINITY);  // |tau| feed-forward (Nm)
+    JointArray max_kp           = filled(1000.0f);
+    JointArray max_kd           = filled(20.0f);
+
+    bool clamp_position = true;  // Clamp q to JOINT_POS_* (PJS) or MOTOR_POS_* (MS)
+
+    // Gains for holding a non-finite joint command after reset(state, mode), before any
+    // valid command was filtered (afterwards the last filtered gains are used)
+    JointArray hold_kp = DEFAULT_KP;
+    JointArray hold_kd = DEFAULT_KD;
+
+    static JointArray filled(float v) {
+        JointArray a;
+        a.fill(v);
+        return a;
+    }
+};
+
+/**
+ * @brief Counters since construction
+ *
+ * Joint counters are incremented once per joint per apply() call.
+ */
+struct CommandFilterStats {
+    uint64_t commands      = 0;  // apply() calls
+    uint64_t dropped       = 0;  // Commands rejected (non-finite values and no previous command to hold)
+    uint64_t nan_replaced  = 0;  // Joints whose non-finite command was replaced by a hold
+    uint64_t q_limited     = 0;  // Joints whose q was changed by the position or rate limit
+    uint64_t dq_limited    = 0;
+    uint64_t tau_limited   = 0;
+    uint64_t gains_limited = 0;  // Joints whose kp or kd was clamped
+};
+
+/**
+ * @brief Safety stage for LowCmd: NaN rejection, position/rate limits and gain bounds
+ *
+ * For every motor, in this order:
+ * - Commands with a non-finite q/dq/tau/kp/kd hold the previous q with zero dq/tau
+ *   and the previous gains (hold_kp/hold_kd right after reset(state, mode)). If
+ *   there is no previous command, apply() returns false.
+ * - q is clamped to the position limits of the command's KinematicMode.
+ * - The position step from the previous command is limited so that the implied
+ *   velocity stays within max_velocity, changes by at most max_acceleration * dt,
+ *   and can still be braked to zero at max_acceleration before reaching the
+ *   target, so a step in q is approached without overshoot.
+ * - dq, tau, kp and kd are clamped to their bounds (kp, kd >= 0).
+ *
+ * Rate limiting starts from the previous filtered command, or from reset(state).
+ * Without reset(), the first command (and the first after a KinematicMode change)
+ * is only position clamped.
+ *
+ * The per-joint work runs on SIMD vectors (see joint_math.hpp); a full LowCmd
+ * takes well under a microsecond.
+ *
+ * Example:
+ * @code
+ * CommandFilter filter;
+ * filter.reset(latest_state, KinematicMode::PJS);
+ * ...
+ * publisher.write(cmd, filter);  // filters cmd in place, then writes it
+ * @endcode
+ */
+class CommandFilter {
+  public:
+    explicit CommandFilter(const CommandFilterConfig &config = CommandFilterConfig()) { set_config(config); }
+
+    void set_config(const CommandFilterConfig &config) {
+        config_ = config;
+        for (size_t j = 0; j < N_JOINTS; j++) {
+            vmax_[j]  = config.max_velocity[j];
+            amax_[j]  = config.max_acceleration[j];
+            tmax_[j]  = config.max_tau[j];
+            kpmax_[j] = config.max_kp[j];
+            kdmax_[j] = config.max_kd[j];
+        }
+        mode_valid_ = false;  // reload position limits on the next apply()
+    }
+
+    const CommandFilterConfig &config() const { return config_; }
+
+    // Start rate limiting from the measured robot position in the given mode
+    void reset(const LowState &state, KinematicMode mode) {
+        for (size_t j = 0; j < N_JOINTS; j++) {
+            prev_q_[j]  = mode == KinematicMode::MS ? state.motor_state()[j].q() : state.joint_state()[j].q();
+            prev_v_[j]  = 0.0f;
+            prev_kp_[j] = config_.hold_kp[j];
+            prev_kd_[j] = config_.hold_kd[j];
+        }
+        load_limits(mode);
+        seeded_ = true;
+    }
+
+    // Forget the previous command (the next one is only position clamped)
+    void reset() { seeded_ = false; }
+
+    // Filter cmd in place using config().dt; returns false if it must not be sent
+    bool apply(LowCmd &cmd) { return apply(cmd, config_.dt); }
+
+    // Filter cmd in place for a control period of dt seconds; returns false if it must not be sent
+    bool apply(LowCmd &cmd, float dt);
+
+    const CommandFilterStats &stats() const { return stats_; }
+
+  private:
+    static constexpr size_t LANES = 32;
+
+    void load_limits(KinematicMode mode) {
+        const JointArray &lo = pos_min(mode);
+        const JointArray &hi = pos_max(mode);
+        for (size_t j = 0; j < N_JOINTS; j++) {
+            qmin_[j] = config_.clamp_position ? lo[j] : -INFINITY;
+            qmax_[j] = config_.clamp_position ? hi[j] : INFINITY;
+        }
+        mode_       = mode;
+        mode_valid_ = true;
+    }
+
+    void limit(float dt);
+
+    // Largest speed toward a target e away that, decelerating by a * dt (= dv) per
+    // period, stops on it: v with v * dt * (k + 1) / 2 <= |e| for k = v / dv steps.
+    // Equals |e| / dt near the target, so the last step lands on it. NaN when a is
+    // INFINITY, which the clamps below treat as no limit.
+    static float braking_speed(float a, float dv, float e) {
+        const float h = 0.5f * dv;
+        return std::sqrt(h * h + 2.0f * a * std::fabs(e)) - h;
+    }
+
+    CommandFilterConfig config_;
+    CommandFilterStats stats_;
+
+    KinematicMode mode_ = KinematicMode::MS;
+    bool mode_valid_    = false;
+    bool seeded_        = false;
+
+    // SoA working set, padded to whole SIMD vectors (padding lanes stay 0)
+    alignas(32) float q_[LANES]       = {};
+    alignas(32) float dq_[LANES]      = {};
+    alignas(32) float tau_[LANES]     = {};
+    alignas(32) float kp_[LANES]      = {};
+    alignas(32) float kd_[LANES]      = {};
+    alignas(32) float prev_q_[LANES]  = {};
+    alignas(32) float prev_v_[LANES]  = {};
+    alignas(32) float prev_kp_[LANES] = {};
+    alignas(32) float prev_kd_[LANES] = {};
+    alignas(32) float qmin_[LANES]    = {};
+    alignas(32) float qmax_[LANES]    = {};
+    alignas(32) float vmax_[LANES]    = {};
+    alignas(32) float amax_[LANES]    = {};
+    alignas(32) float tmax_[LANES]    = {};
+    alignas(32) float kpmax_[LANES]   = {};
+    alignas(32) float kdmax_[LANES]   = {};
+};
+
+inline bool CommandFilter::apply(LowCmd &cmd, float dt) {
+    stats_.commands++;
+
+    // Positions of different kinematic modes are not comparable
+    KinematicMode mode = cmd.kinematic_mode();
+    if (!mode_valid_ || mode != mode_) {
+        if (mode_valid_) seeded_ = false;
+        load_limits(mode);
+    }
+
+    // Gather into SoA and find non-finite commands
+    auto &motors = cmd.motors();
+    uint32_t bad = 0;
+    for (size_t j = 0; j < N_JOINTS; j++) {
+        const MotorCmd &m = motors[j];
+        q_[j]             = m.q();
+        dq_[j]            = m.dq();
+        tau_[j]           = m.tau();
+        kp_[j]            = m.kp();
+        kd_[j]            = m.kd();
+        if (!std::isfinite(q_[j]) || !std::isfinite(dq_[j]) || !std::isfinite(tau_[j]) || !std::isfinite(kp_[j]) ||
+            !std::isfinite(kd_[j])) {
+            bad |= 1u << j;
+        }
+    }
+
+    if (bad) {
+        if (!seeded_) {
+            stats_.dropped++;
+            return false;
+        }
+        for (size_t j = 0; j < N_JOINTS; j++) {
+            if (!(bad & (1u << j))) continue;
+            q_[j]   = prev_q_[j];
+            dq_[j]  = 0.0f;
+            tau_[j] = 0.0f;
+            kp_[j]  = prev_kp_[j];
+            kd_[j]  = prev_kd_[j];
+            stats_.nan_replaced++;
+        }
+    }
+
+    limit(dt > 0.0f ? dt : config_.dt);
+
+    // Scatter back, counting joints that were changed
+    for (size_t j = 0; j < N_JOINTS; j++) {
+        MotorCmd &m = motors[j];
+        if (bad & (1u << j)) {
+            m.q(q_[j]);
+            m.dq(dq_[j]);
+            m.tau(tau_[j]);
+            m.kp(kp_[j]);
+            m.kd(kd_[j]);
+            continue;
+        }
+        if (m.q() != q_[j]) {
+            stats_.q_limited++;
+            m.q(q_[j]);
+        }
+        if (m.dq() != dq_[j]) {
+            stats_.dq_limited++;
+            m.dq(dq_[j]);
+        }
+        if (m.tau() != tau_[j]) {
+            stats_.tau_limited++;
+            m.tau(tau_[j]);
+        }
+        if (m.kp() != kp_[j] || m.kd() != kd_[j]) {
+            stats_.gains_limited++;
+            m.kp(kp_[j]);
+            m.kd(kd_[j]);
+        }
+    }
+    return true;
+}
+
+inline void CommandFilter::limit(float dt) {
+    const bool rate = seeded_;
+    size_t i        = 0;
+#if defined(IGRIS_SDK_JOINT_MATH_AVX) || defined(IGRIS_SDK_JOINT_MATH_SSE)
+    using S         = detail::JointSimd;
+    // NaN bounds (INFINITY limits in braking_speed()) leave v unchanged: min/max return their second operand
+    auto clamp_v    = [](S::F v, S::F lo, S::F hi) { return S::max(lo, S::min(hi, v)); };
+    const S::F zero = S::set1(0.0f);
+    const S::F vdt  = S::set1(dt);
+    const S::F vinv = S::set1(1.0f / dt);
+    for (; i < LANES; i += S::W) {
+        S::F qmin = S::load(qmin_ + i), qmax = S::load(qmax_ + i);
+        S::F vmax = S::load(vmax_ + i);
+        S::F q    = clamp_v(S::load(q_ + i), qmin, qmax);
+        S::F v    = zero;
+        if (rate) {
+            S::F qp = S::load(prev_q_ + i);
+            S::F vp = S::load(prev_v_ + i);
+            S::F a  = S::load(amax_ + i);
+            S::F dv = S::mul(a, vdt);
+            S::F e  = S::sub(q, qp);
+            S::F h  = S::mul(dv, S::set1(0.5f));
+            S::F vb = S::sub(S::sqrt(S::add(S::mul(h, h), S::mul(S::add(a, a), S::max(e, S::sub(zero, e))))), h);
+            v       = S::mul(e, vinv);
+            v       = clamp_v(v, S::sub(zero, vb), vb);
+            v       = clamp_v(v, S::sub(vp, dv), S::add(vp, dv));
+            v       = clamp_v(v, S::sub(zero, vmax), vmax);
+            // A step reaching the target lands on it instead of one rounding error past it
+            S::F inf = S::set1(INFINITY);
+            S::F lo  = S::select_ge(e, zero, S::sub(zero, inf), q);
+            S::F hi  = S::select_ge(e, zero, q, inf);
+            q        = clamp_v(clamp_v(S::add(qp, S::mul(v, vdt)), lo, hi), qmin, qmax);
+        }
+        S::F tmax = S::load(tmax_ + i);
+        S::store(q_ + i, q);
+        S::store(prev_q_ + i, q);
+        S::store(prev_v_ + i, v);
+        S::store(dq_ + i, clamp_v(S::load(dq_ + i), S::sub(zero, vmax), vmax));
+        S::store(tau_ + i, clamp_v(S::load(tau_ + i), S::sub(zero, tmax), tmax));
+        S::F kp = clamp_v(S::load(kp_ + i), zero, S::load(kpmax_ + i));
+        S::F kd = clamp_v(S::load(kd_ + i), zero, S::load(kdmax_ + i));
+        S::store(kp_ + i, kp);
+        S::store(kd_ + i, kd);
+        S::store(prev_kp_ + i, kp);
+        S::store(prev_kd_ + i, kd);
+    }
+#endif
+    auto clamp_s = [](float v, float lo, float hi) { return detail::clamp_one(v, lo, hi); };
+    for (; i < LANES; i++) {
+        float q = clamp_s(q_[i], qmin_[i], qmax_[i]);
+        float v = 0.0f;
+        if (rate) {
+            float dv = amax_[i] * dt;
+            float e  = q - prev_q_[i];
+            float vb = braking_speed(amax_[i], dv, e);
+            v        = e * (1.0f / dt);
+            v        = clamp_s(v, -vb, vb);
+            v        = clamp_s(v, prev_v_[i] - dv, prev_v_[i] + dv);
+            v        = clamp_s(v, -vmax_[i], vmax_[i]);
+            float qn = prev_q_[i] + v * dt;
+            qn       = e >= 0.0f ? std::min(qn, q) : std::max(qn, q);
+            q        = clamp_s(qn, qmin_[i], qmax_[i]);
+        }
+        q_[i]       = q;
+        prev_q_[i]  = q;
+        prev_v_[i]  = v;
+        dq_[i]      = clamp_s(dq_[i], -vmax_[i], vmax_[i]);
+        tau_[i]     = clamp_s(tau_[i], -tmax_[i], tmax_[i]);
+        kp_[i]      = clamp_s(kp_[i], 0.0f, kpmax_[i]);
+        kd_[i]      = clamp_s(kd_[i], 0.0f, kdmax_[i]);
+        prev_kp_[i] = kp_[i];
+        prev_kd_[i] = kd_[i];
+    }
+    seeded_ = true;
+}
+
+}  // namespace igris_sdk
@@ -0,0 +1,340 @@
+#pragma once
+
+#include "igris_sdk/joint_math.hpp"
+#include "igris_sdk/lowcmd_arrays.hpp"
+#include "igris_sdk/publisher.hpp"
+#include "igris_sdk/types.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <iostream>
+#include <mutex>
+#include <thread>
+
+#if defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+namespace igris_sdk {
+
+/**
+ * @brief Configuration for CommandScheduler
+ */
+struct CommandSchedulerConfig {
+    uint32_t period_us        = 3333;  // Publish period (~300Hz)
+    uint32_t interpolation_us = 0;     // > 0: ramp linearly from the current command to a new target over this time
+    uint32_t late_us          = 500;   // Wake-ups later than this behind schedule count as late
+
+    int cpu_core = -1;  // Pin the publish thread to this core (-1: no pinning)
+    int priority = 0;   // SCHED_FIFO priority (0: inherit; needs CAP_SYS_NICE)
+};
+
+/**
+ * @brief Whole-body command target (LowCmd index order)
+ */
+struct CommandTarget {
+    KinematicMode mode = KinematicMode::PJS;
+    JointArray q{};
+    JointArray dq{};
+    JointArray tau{};
+    JointArray kp{};
+    JointArray kd{};
+};
+
+/**
+ * @brief Publish timing statistics
+ */
+struct CommandSchedulerStats {
+    uint64_t published      = 0;  // Commands published
+    uint64_t targets        = 0;  // Targets picked up (commits overwritten before a tick are not counted)
+    uint64_t late_periods   = 0;  // Wake-ups more than late_us behind schedule
+    uint64_t missed_periods = 0;  // Periods skipped after falling a full period behind
+    uint64_t last_jitter_us = 0;  // Wake-up delay behind schedule of the last period
+    uint64_t max_jitter_us  = 0;
+    double mean_jitter_us   = 0.0;
+    uint64_t max_write_us   = 0;  // Longest publisher.write() alone (interpolation and LowCmd filling excluded)
+};
+
+/**
+ * @brief Fixed-rate LowCmd publisher fed with targets from another thread
+ *
+ * Owns the timed publish loop applications otherwise write themselves: a thread
+ * wakes every period_us and publishes the current command (republishing the
+ * last one when no new target arrived), so the robot sees a steady command
+ * stream however irregularly a UI or planner updates its targets.
+ *
+ * Targets are handed over through a triple buffer: commit() never waits for the
+ * publish thread and the publish thread never waits for commit(); each tick uses
+ * the newest committed target, and targets committed in between are skipped.
+ * target()/commit()/set_target()/pause() belong to one producer thread.
+ *
+ * With interpolation_us > 0, all fields (q, dq, tau, kp, kd) ramp linearly from
+ * the command being published to a new target. The first target after start()
+ * or pause(), and a target in another KinematicMode, are applied as a step, so
+ * the first target should be the measured position.
+ *
+ * Example:
+ * @code
+ * CommandSchedulerConfig config;
+ * config.interpolation_us = 200000;  // 200ms ramps between targets
+ * CommandScheduler scheduler(publisher, config);
+ * scheduler.start();
+ *
+ * // UI/planner thread
+ * CommandTarget &target = scheduler.target();
+ * target.q  = measured_q;  // first target: hold the current position
+ * target.kp = kp;
+ * target.kd = kd;
+ * scheduler.commit();
+ * ...
+ * scheduler.target().q[MotorIndex::L_ELBOW] = -0.5f;  // LowCmd index order (joint_limits.hpp)
+ * scheduler.commit();
+ * @endcode
+ */
+class CommandScheduler {
+  public:
+    explicit CommandScheduler(Publisher<LowCmd> &publisher, const CommandSchedulerConfig &config = CommandSchedulerConfig())
+        : publisher_(publisher), config_(config) {
+        config_.period_us = std::max<uint32_t>(config_.period_us, 1);
+    }
+
+    ~CommandScheduler() { stop(); }
+
+    CommandScheduler(const CommandScheduler &)            = delete;
+    CommandScheduler &operator=(const CommandScheduler &) = delete;
+
+    // Start the publish thread; nothing is published until the first commit()
+    bool start();
+
+    // Stop the publish thread
+    void stop();
+
+    bool is_running() const { return running_.load(std::memory_order_acquire); }
+
+    // ========== Producer ==========
+
+    // Target being edited; keeps its values across commits
+    CommandTarget &target() { return staging_; }
+
+    // Hand target() to the publish thread (wait-free)
+    void commit() {
+        Slot &slot  = slots_[back_];
+        slot.target = staging_;
+        slot.epoch  = epoch_.load(std::memory_order_relaxed);
+        back_       = middle_.exchange(back_ | FRESH, std::memory_order_acq_rel) & INDEX;
+    }
+
+    // Replace target() and commit it
+    void set_target(const CommandTarget &target) {
+        staging_ = target;
+        commit();
+    }
+
+    // Stop publishing until the next commit(), which is then applied as a step
+    void pause() { epoch_.fetch_add(1, std::memory_order_acq_rel); }
+
+    // ========== Any thread ==========
+
+    CommandSchedulerStats stats() const {
+        std::lock_guard<std::mutex> lock(stats_mutex_);
+        return stats_;
+    }
+
+    void reset_stats() {
+        std::lock_guard<std::mutex> lock(stats_mutex_);
+        stats_         = CommandSchedulerStats();
+        jitter_sum_us_ = 0.0;
+        jitter_count_  = 0;
+    }
+
+  private:
+    using Clock = std::chrono::steady_clock;
+
+    static constexpr uint8_t INDEX = 0x3;
+    static constexpr uint8_t FRESH = 0x4;
+
+    struct Slot {
+        CommandTarget target;
+        uint64_t epoch = 0;
+    };
+
+    void run();
+    void apply_thread_settings();
+    bool take(uint64_t epoch);
+    void update_command(Clock::time_point now);
+
+    Publisher<LowCmd> &publisher_;
+    CommandSchedulerConfig config_;
+
+    // Triple buffer: back_ is the producer's, front_ the publish thread's, middle_ the
+    // last committed slot (FRESH until the publish thread swaps it in)
+    Slot slots_[3];
+    uint8_t back_ = 0;
+    alignas(64) std::atomic<uint8_t> middle_{1};
+    uint8_t front_ = 2;
+    std::atomic<uint64_t> epoch_{0};
+    CommandTarget staging_;
+
+    // Publish thread only
+    bool have_target_ = false;
+    bool ramping_     = false;
+    Clock::time_point ramp_start_;
+    CommandTarget from_;
+    CommandTarget goal_;
+    CommandTarget out_;
+    LowCmd cmd_;
+
+    std::mutex wake_mutex_;
+    std::condition_variable wake_;
+    std::atomic<bool> running_{false};
+    std::thread thread_;
+
+    mutable std::mutex stats_mutex_;
+    CommandSchedulerStats stats_;
+    double jitter_sum_us_  = 0.0;
+    uint64_t jitter_count_ = 0;
+};
+
+inline bool CommandScheduler::start() {
+    if (running_.load(std::memory_order_acquire)) {
+        std::cerr << "[CommandScheduler] Already running" << std::endl;
+        return false;
+    }
+    have_target_ = false;
+    ramping_     = false;
+    running_.store(true, std::memory_order_release);
+    thread_ = std::thread(&CommandScheduler::run, this);
+    std::cout << "[CommandScheduler] Started (period " << config_.period_us << " us)" << std::endl;
+    return true;
+}
+
+inline void CommandScheduler::stop() {
+    {
+        std::lock_guard<std::mutex> lock(wake_mutex_);
+        if (!running_.exchange(false, std::memory_order_acq_rel)) return;
+    }
+    wake_.notify_all();
+    if (thread_.joinable()) thread_.join();
+    std::cout << "[CommandScheduler] Stopped" << std::endl;
+}
+
+inline void CommandScheduler::apply_thread_settings() {
+#if defined(__linux__)
+    if (config_.cpu_core >= 0) {
+        cpu_set_t set;
+        CPU_ZERO(&set);
+        CPU_SET(config_.cpu_core, &set);
+        if (pthread_setaffinity_np(pthread_self(), sizeof(set), &set) != 0) {
+            std::cerr << "[CommandScheduler] Failed to pin to CPU " << config_.cpu_core << std::endl;
+        }
+    }
+    if (config_.priority > 0) {
+        sched_param param{};
+        param.sched_priority = config_.priority;
+        if (pthread_setschedparam(pthread_self(), SCHED_FIFO, &param) != 0) {
+            std::cerr << "[CommandScheduler] Failed to set SCHED_FIFO priority " << config_.priority << " (needs CAP_SYS_NICE)" << std::endl;
+        }
+    }
+#endif
+}
+
+// Swap in the newest committed target; false if there is none from the current epoch
+inline bool CommandScheduler::take(uint64_t epoch) {
+    if (!(middle_.load(std::memory_order_relaxed) & FRESH)) return false;
+    front_ = middle_.exchange(front_, std::memory_order_acq_rel) & INDEX;
+    return slots_[front_].epoch == epoch;
+}
+
+// Advance out_ toward goal_ (publish thread)
+inline void CommandScheduler::update_command(Clock::time_point now) {
+    if (!ramping_) return;
+    const float t = std::chrono::duration<float, std::micro>(now - ramp_start_).count() / config_.interpolation_us;
+    if (t >= 1.0f) {
+        out_     = goal_;
+        ramping_ = false;
+        return;
+    }
+    lerp_joints(from_.q.data(), goal_.q.data(), t, out_.q.data(), N_JOINTS);
+    lerp_joints(from_.dq.data(), goal_.dq.data(), t, out_.dq.data(), N_JOINTS);
+    lerp_joints(from_.tau.data(), goal_.tau.data(), t, out_.tau.data(), N_JOINTS);
+    lerp_joints(from_.kp.data(), goal_.kp.data(), t, out_.kp.data(), N_JOINTS);
+    lerp_joints(from_.kd.data(), goal_.kd.data(), t, out_.kd.data(), N_JOINTS);
+}
+
+inline void CommandScheduler::run() {
+    apply_thread_settings();
+
+    const auto period = std::chrono::microseconds(config_.period_us);
+    uint64_t epoch    = epoch_.load(std::memory_order_acquire);
+    auto next         = Clock::now() + period;
+
+    while (true) {
+        {
+            std::unique_lock<std::mutex> lock(wake_mutex_);
+            if (wake_.wait_until(lock, next, [this] { return !running_; })) break;
+        }
+        const auto woke       = Clock::now();
+        const uint64_t jitter = static_cast<uint64_t>(std::max<int64_t>(
+            0, std::chrono::duration_cast<std::chrono::microseconds>(woke - next).count()));
+
+        // pause(): drop the current command until a target of the new epoch arrives
+        const uint64_t current_epoch = epoch_.load(std::memory_order_acquire);
+        if (current_epoch != epoch) {
+            epoch        = current_epoch;
+            have_target_ = false;
+            ramping_     = false;
+        }
+
+        bool new_target = take(epoch);
+        if (new_target) {
+            const CommandTarget &target = slots_[front_].target;
+            if (!have_target_ || config_.interpolation_us == 0 || target.mode != out_.mode) {
+                out_     = target;
+                ramping_ = false;
+            } else {
+                from_       = out_;
+                goal_       = target;
+                ramp_start_ = woke;
+                ramping_    = true;
+            }
+            have_target_ = true;
+        }
+
+        uint64_t write_us = 0;
+        bool published    = false;
+        if (have_target_) {
+            update_command(woke);
+            fill_low_cmd(cmd_, out_.q.data(), out_.dq.data(), out_.tau.data(), out_.kp.data(), out_.kd.data(), out_.mode);
+            const auto write_start = Clock::now();
+            published              = publisher_.write(cmd_);
+            write_us = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - write_start).count());
+        }
+
+        // Fell a full period or more behind: skip the missed periods instead of bursting
+        next += period;
+        const auto now  = Clock::now();
+        int64_t missed  = 0;
+        if (now - next >= period) {
+            missed = (now - next) / period;
+            next += missed * period;
+        }
+
+        std::lock_guard<std::mutex> lock(stats_mutex_);
+        if (published) stats_.published++;
+        if (new_target) stats_.targets++;
+        if (jitter > config_.late_us) stats_.late_periods++;
+        stats_.missed_periods += static_cast<uint64_t>(missed);
+        stats_.last_jitter_us = jitter;
+        stats_.max_jitter_us  = std::max(stats_.max_jitter_us, jitter);
+        jitter_sum_us_ += static_cast<double>(jitter);
+        jitter_count_++;
+        stats_.mean_jitter_us = jitter_sum_us_ / jitter_count_;
+        stats_.max_write_us   = std::max(stats_.max_write_us, write_us);
+    }
+}
+
+}  // namespace igris_sdk
@@ -0,0 +1,278 @@
+#pragma once
+
+#include "igris_sdk/joint_limits.hpp"
+#include "igris_sdk/joint_math.hpp"
+#include "igris_sdk/publisher.hpp"
+#include "igris_sdk/types.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <mutex>
+#include <thread>
+
+#if defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+namespace igris_sdk {
+
+enum class WatchdogAction {
+    Hold,     // PD hold at the position measured when the stall started
+    Damping,  // kp = 0, damping only
+};
+
+/**
+ * @brief Configuration for CommandWatchdog
+ */
+struct CommandWatchdogConfig {
+    uint32_t period_us    = 1000;  // Expected LowCmd period of the user control loop
+    uint32_t miss_budget  = 5;     // Consecutive missed periods before the watchdog takes over
+    WatchdogAction action = WatchdogAction::Hold;
+
+    // Gains of the hold command (defaults match the examples' PD gains)
+    JointArray hold_kp = DEFAULT_KP;
+    JointArray hold_kd = DEFAULT_KD;
+
+    int cpu_core = -1;  // Pin the watchdog thread to this core (-1: no pinning)
+    int priority = 0;   // SCHED_FIFO priority (0: inherit; needs CAP_SYS_NICE)
+};
+
+/**
+ * @brief Stall statistics
+ */
+struct CommandWatchdogStats {
+    uint64_t stalls           = 0;  // Times the watchdog took over
+    uint64_t hold_commands    = 0;  // Commands published by the watchdog
+    uint64_t last_stall_us    = 0;  // Gap between user commands of the last finished stall
+    uint64_t longest_stall_us = 0;
+    uint64_t total_stall_us   = 0;
+    bool stalled              = false;  // Watchdog is currently publishing
+};
+
+/**
+ * @brief Publishes a hold or damping LowCmd when the user control loop stops writing
+ *
+ * The watchdog thread wakes every period_us and checks the time of the last user
+ * command. When more than miss_budget periods have passed, it publishes a
+ * preallocated command built from the latest LowState (same KinematicMode as the
+ * last user command) every period until the user writes again.
+ *
+ * The watchdog only acts after the first user command and the first LowState, and
+ * stops acting after disarm() (e.g. before an intentional stop of the control loop).
+ *
+ * Example:
+ * @code
+ * CommandWatchdog watchdog(publisher);
+ * sub.init([&](const LowState &s) { watchdog.update_state(s); });
+ * watchdog.start();
+ * while (running) {
+ *     publisher.write(cmd, watchdog);  // records the write, then publishes
+ * }
+ * watchdog.disarm();
+ * @endcode
+ */
+class CommandWatchdog {
+  public:
+    explicit CommandWatchdog(Publisher<LowCmd> &publisher, const CommandWatchdogConfig &config = CommandWatchdogConfig())
+        : publisher_(publisher), config_(config) {
+        config_.period_us   = std::max<uint32_t>(config_.period_us, 1);
+        config_.miss_budget = std::max<uint32_t>(config_.miss_budget, 1);
+        for (size_t i = 0; i < N_JOINTS; i++) {
+            hold_cmd_.motors()[i].id(static_cast<uint16_t>(i));
+        }
+    }
+
+    ~CommandWatchdog() { stop(); }
+
+    CommandWatchdog(const CommandWatchdog &)            = delete;
+    CommandWatchdog &operator=(const CommandWatchdog &) = delete;
+
+    // Start the watchdog thread
+    bool start();
+
+    // Stop the watchdog thread
+    void stop();
+
+    // Record a user command (use as publisher.write(cmd, watchdog)); never rejects
+    bool apply(LowCmd &cmd) {
+        feed(cmd.kinematic_mode());
+        return true;
+    }
+
+    // Record a user command written in the given mode
+    void feed(KinematicMode mode = KinematicMode::MS);
+
+    // Latest robot state, used to build the hold command
+    void update_state(const LowState &state) {
+        std::lock_guard<std::mutex> lock(state_mutex_);
+        for (size_t i = 0; i < N_JOINTS; i++) {
+            state_q_ms_[i]  = state.motor_state()[i].q();
+            state_q_pjs_[i] = state.joint_state()[i].q();
+        }
+        have_state_ = true;
+    }
+
+    // Stop taking over until the next user command
+    void disarm() { armed_.store(false, std::memory_order_release); }
+
+    bool is_running() const { return running_.load(std::memory_order_acquire); }
+
+    CommandWatchdogStats stats() const {
+        std::lock_guard<std::mutex> lock(stats_mutex_);
+        CommandWatchdogStats s = stats_;
+        s.stalled              = stalled_.load(std::memory_order_acquire);
+        return s;
+    }
+
+  private:
+    static int64_t now_ns() {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+
+    void run();
+    void apply_thread_settings();
+    bool build_hold_command();
+
+    Publisher<LowCmd> &publisher_;
+    CommandWatchdogConfig config_;
+
+    std::thread thread_;
+    std::atomic<bool> running_{false};
+    std::atomic<bool> armed_{false};
+    std::atomic<bool> stalled_{false};
+    std::atomic<int64_t> last_write_ns_{0};
+    std::atomic<KinematicMode> mode_{KinematicMode::MS};
+
+    // Latest LowState positions (written by update_state)
+    std::mutex state_mutex_;
+    bool have_state_ = false;
+    JointArray state_q_ms_{};
+    JointArray state_q_pjs_{};
+
+    // Preallocated hold command (watchdog thread only)
+    LowCmd hold_cmd_;
+    std::mutex hold_mutex_;  // Held while re-checking and writing hold_cmd_
+
+    mutable std::mutex stats_mutex_;
+    CommandWatchdogStats stats_;
+};
+
+inline bool CommandWatchdog::start() {
+    if (running_.load(std::memory_order_acquire)) {
+        std::cerr << "[CommandWatchdog] Already running" << std::endl;
+        return false;
+    }
+    running_.store(true, std::memory_order_release);
+    thread_ = std::thread(&CommandWatchdog::run, this);
+    std::cout << "[CommandWatchdog] Started (timeout " << config_.period_us * config_.miss_budget << " us)" << std::endl;
+    return true;
+}
+
+inline void CommandWatchdog::stop() {
+    if (!running_.exchange(false, std::memory_order_acq_rel)) return;
+    if (thread_.joinable()) thread_.join();
+    std::cout << "[CommandWatchdog] Stopped" << std::endl;
+}
+
+inline void CommandWatchdog::feed(KinematicMode mode) {
+    // seq_cst on last_write_ns_/stalled_ pairs with run(): either run() sees this timestamp
+    // before publishing, or this sees the latched stall and waits for the hold write below
+    int64_t now  = now_ns();
+    int64_t last = last_write_ns_.exchange(now, std::memory_order_seq_cst);
+    mode_.store(mode, std::memory_order_relaxed);
+    armed_.store(true, std::memory_order_release);
+
+    // The user loop is back: close the stall
+    if (stalled_.exchange(false, std::memory_order_seq_cst)) {
+        // A hold command being written must not land after this user command
+        { std::lock_guard<std::mutex> hold_lock(hold_mutex_); }
+        uint64_t gap_us = static_cast<uint64_t>(std::max<int64_t>(0, now - last)) / 1000;
+        std::lock_guard<std::mutex> lock(stats_mutex_);
+        stats_.last_stall_us    = gap_us;
+        stats_.longest_stall_us = std::max(stats_.longest_stall_us, gap_us);
+        stats_.total_stall_us += gap_us;
+    }
+}
+
+inline void CommandWatchdog::apply_thread_settings() {
+#if defined(__linux__)
+    if (config_.cpu_core >= 0) {
+        cpu_set_t set;
+        CPU_ZERO(&set);
+        CPU_SET(config_.cpu_core, &set);
+        if (pthread_setaffinity_np(pthread_self(), sizeof(set), &set) != 0) {
+            std::cerr << "[CommandWatchdog] Failed to pin to CPU " << config_.cpu_core << std::endl;
+        }
+    }
+    if (config_.priority > 0) {
+        sched_param param{};
+        param.sched_priority = config_.priority;
+        if (pthread_setschedparam(pthread_self(), SCHED_FIFO, &param) != 0) {
+            std::cerr << "[CommandWatchdog] Failed to set SCHED_FIFO priority " << config_.priority << " (needs CAP_SYS_NICE)" << std::endl;
+        }
+    }
+#endif
+}
+
+// Latch the latest measured position into hold_cmd_; false if no LowState was received yet
+inline bool CommandWatchdog::build_hold_command() {
+    KinematicMode mode = mode_.load(std::memory_order_relaxed);
+    std::lock_guard<std::mutex> lock(state_mutex_);
+    if (!have_state_) return false;
+    const JointArray &q = mode == KinematicMode::MS ? state_q_ms_ : state_q_pjs_;
+    const bool hold     = config_.action == WatchdogAction::Hold;
+    hold_cmd_.kinematic_mode(mode);
+    for (size_t i = 0; i < N_JOINTS; i++) {
+        MotorCmd &m = hold_cmd_.motors()[i];
+        m.q(q[i]);
+        m.dq(0.0f);
+        m.tau(0.0f);
+        m.kp(hold ? config_.hold_kp[i] : 0.0f);
+        m.kd(config_.hold_kd[i]);
+    }
+    return true;
+}
+
+inline void CommandWatchdog::run() {
+    apply_thread_settings();
+
+    const auto period        = std::chrono::microseconds(config_.period_us);
+    const int64_t timeout_ns = static_cast<int64_t>(config_.period_us) * config_.miss_budget * 1000;
+    auto next                = std::chrono::steady_clock::now();
+
+    while (running_.load(std::memory_order_acquire)) {
+        next += period;
+        std::this_thread::sleep_until(next);
+
+        if (!armed_.load(std::memory_order_acquire)) continue;
+        const int64_t last = last_write_ns_.load(std::memory_order_acquire);
+        if (now_ns() - last <= timeout_ns) continue;
+
+        // Stall: latch the hold command once, then repeat it every period
+        const bool latching = !stalled_.load(std::memory_order_acquire);
+        if (latching) {
+            if (!build_hold_command()) continue;
+            stalled_.store(true, std::memory_order_seq_cst);
+        }
+
+        // Re-check under hold_mutex_: a feed() since the check above is either visible here,
+        // or saw stalled_ and waits for this write, so the hold never follows a user command
+        std::unique_lock<std::mutex> hold_lock(hold_mutex_);
+        if (last_write_ns_.load(std::memory_order_seq_cst) != last) {
+            stalled_.store(false, std::memory_order_release);
+            continue;
+        }
+        const bool written = publisher_.write(hold_cmd_);
+        hold_lock.unlock();
+
+        std::lock_guard<std::mutex> lock(stats_mutex_);
+        if (latching) stats_.stalls++;
+        if (written) stats_.hold_commands++;
+    }
+}
+
+}  // namespace igris_sdk
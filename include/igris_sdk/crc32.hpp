@@ -0,0 +1,210 @@
+#pragma once
+
+#include "igris_sdk/types.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+#include <immintrin.h>
+#define IGRIS_SDK_CRC32_HAS_CLMUL 1
+#else
+#define IGRIS_SDK_CRC32_HAS_CLMUL 0
+#endif
+
+namespace igris_sdk {
+
+// Accelerated variants of crc32_core() (utils.hpp).
+//
+// All functions here are bit-exact with crc32_core(): CRC-32/MPEG-2
+// (polynomial 0x04C11DB7, MSB-first, init 0xFFFFFFFF, no final XOR),
+// fed with the bytes of `data` in memory order.
+//
+// Note: the SSE4.2 crc32 instruction implements CRC-32C (0x1EDC6F41,
+// reflected) and cannot reproduce this polynomial, so the hardware path
+// uses carry-less multiply (PCLMULQDQ) folding instead.
+
+constexpr uint32_t CRC32_POLY = 0x04C11DB7u;
+constexpr uint32_t CRC32_INIT = 0xFFFFFFFFu;
+
+// Number of 32-bit words hashed by crc32_lowcmd(): kinematic_mode + 31 x (id, q, dq, tau, kp, kd)
+constexpr uint32_t LOWCMD_CRC_WORDS = 1 + 31 * 6;
+
+namespace detail {
+
+using Crc32Tables = std::array<std::array<uint32_t, 256>, 8>;
+
+constexpr Crc32Tables make_crc32_tables() {
+    Crc32Tables t{};
+    for (uint32_t i = 0; i < 256; i++) {
+        uint32_t c = i << 24;
+        for (int b = 0; b < 8; b++) {
+            c = (c & 0x80000000u) ? (c << 1) ^ CRC32_POLY : (c << 1);
+        }
+        t[0][i] = c;
+    }
+    // t[k][i] = CRC of byte i followed by k zero bytes
+    for (int k = 1; k < 8; k++) {
+        for (uint32_t i = 0; i < 256; i++) {
+            uint32_t prev = t[k - 1][i];
+            t[k][i]       = (prev << 8) ^ t[0][prev >> 24];
+        }
+    }
+    return t;
+}
+
+inline constexpr Crc32Tables CRC32_TABLES = make_crc32_tables();
+
+// x^n mod P (used for the PCLMUL folding constants)
+constexpr uint32_t crc32_xpow_mod(uint32_t n) {
+    uint32_t r = 1;
+    for (uint32_t i = 0; i < n; i++) {
+        r = (r & 0x80000000u) ? (r << 1) ^ CRC32_POLY : (r << 1);
+    }
+    return r;
+}
+
+inline uint32_t crc32_bytewise(uint32_t crc, const uint8_t *p, size_t n) {
+    for (size_t i = 0; i < n; i++) {
+        crc = (crc << 8) ^ CRC32_TABLES[0][(crc >> 24) ^ p[i]];
+    }
+    return crc;
+}
+
+inline uint32_t crc32_slice8(uint32_t crc, const uint8_t *p, size_t n) {
+    const auto &t = CRC32_TABLES;
+    while (n >= 8) {
+        crc ^= (uint32_t(p[0]) << 24) | (uint32_t(p[1]) << 16) | (uint32_t(p[2]) << 8) | uint32_t(p[3]);
+        crc = t[7][crc >> 24] ^ t[6][(crc >> 16) & 0xFF] ^ t[5][(crc >> 8) & 0xFF] ^ t[4][crc & 0xFF] ^  //
+              t[3][p[4]] ^ t[2][p[5]] ^ t[1][p[6]] ^ t[0][p[7]];
+        p += 8;
+        n -= 8;
+    }
+    return crc32_bytewise(crc, p, n);
+}
+
+#if IGRIS_SDK_CRC32_HAS_CLMUL
+
+#define IGRIS_SDK_CRC32_TARGET __attribute__((target("pclmul,ssse3,sse4.1")))
+
+// Load 16 bytes, byte-reversed so the first message byte holds the polynomial's highest coefficients
+IGRIS_SDK_CRC32_TARGET inline __m128i crc32_load(const uint8_t *p) {
+    const __m128i bswap = _mm_setr_epi8(15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0);
+    return _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i *>(p)), bswap);
+}
+
+// Fold `acc` forward by the distance encoded in `k` (hi = x^(d+64) mod P, lo = x^d mod P) and add `next`
+IGRIS_SDK_CRC32_TARGET inline __m128i crc32_fold(__m128i acc, __m128i k, __m128i next) {
+    __m128i hi = _mm_clmulepi64_si128(acc, k, 0x11);
+    __m128i lo = _mm_clmulepi64_si128(acc, k, 0x00);
+    return _mm_xor_si128(_mm_xor_si128(hi, lo), next);
+}
+
+// Requires n >= 16. Processes whole 16-byte blocks with PCLMULQDQ, the tail with slicing-by-8.
+IGRIS_SDK_CRC32_TARGET inline uint32_t crc32_clmul(uint32_t crc, const uint8_t *p, size_t n) {
+    constexpr uint32_t K128_HI = crc32_xpow_mod(128 + 64), K128_LO = crc32_xpow_mod(128);
+    constexpr uint32_t K512_HI = crc32_xpow_mod(512 + 64), K512_LO = crc32_xpow_mod(512);
+    const __m128i k128         = _mm_set_epi64x(K128_HI, K128_LO);
+    const __m128i k512         = _mm_set_epi64x(K512_HI, K512_LO);
+
+    // A running CRC register is equivalent to XOR-ing it into the first 32 message bits
+    __m128i x0 = _mm_xor_si128(crc32_load(p), _mm_set_epi32(int(crc), 0, 0, 0));
+    p += 16;
+    n -= 16;
+
+    if (n >= 48) {
+        __m128i x1 = crc32_load(p);
+        __m128i x2 = crc32_load(p + 16);
+        __m128i x3 = crc32_load(p + 32);
+        p += 48;
+        n -= 48;
+        while (n >= 64) {
+            x0 = crc32_fold(x0, k512, crc32_load(p));
+            x1 = crc32_fold(x1, k512, crc32_load(p + 16));
+            x2 = crc32_fold(x2, k512, crc32_load(p + 32));
+            x3 = crc32_fold(x3, k512, crc32_load(p + 48));
+            p += 64;
+            n -= 64;
+        }
+        x0 = crc32_fold(x0, k128, x1);
+        x0 = crc32_fold(x0, k128, x2);
+        x0 = crc32_fold(x0, k128, x3);
+    }
+    while (n >= 16) {
+        x0 = crc32_fold(x0, k128, crc32_load(p));
+        p += 16;
+        n -= 16;
+    }
+
+    // The folded register is a 16-byte message with the same remainder; finish with the table
+    const __m128i bswap = _mm_setr_epi8(15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0);
+    alignas(16) uint8_t folded[16];
+    _mm_store_si128(reinterpret_cast<__m128i *>(folded), _mm_shuffle_epi8(x0, bswap));
+    uint32_t r = crc32_slice8(0, folded, sizeof(folded));
+    return crc32_slice8(r, p, n);
+}
+
+// Short buffers are cheaper on the table path than paying the fold setup
+inline uint32_t crc32_hw(uint32_t crc, const uint8_t *p, size_t n) { return n >= 64 ? crc32_clmul(crc, p, n) : crc32_slice8(crc, p, n); }
+
+#undef IGRIS_SDK_CRC32_TARGET
+
+#endif  // IGRIS_SDK_CRC32_HAS_CLMUL
+
+using Crc32Fn = uint32_t (*)(uint32_t, const uint8_t *, size_t);
+
+inline Crc32Fn crc32_select() {
+#if IGRIS_SDK_CRC32_HAS_CLMUL
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("pclmul") && __builtin_cpu_supports("sse4.1")) {
+        return crc32_hw;
+    }
+#endif
+    return crc32_slice8;
+}
+
+}  // namespace detail
+
+// True if crc32_core_fast() dispatches to the PCLMULQDQ implementation on this CPU
+inline bool crc32_has_clmul() {
+#if IGRIS_SDK_CRC32_HAS_CLMUL
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("pclmul") && __builtin_cpu_supports("sse4.1");
+#else
+    return false;
+#endif
+}
+
+// Table-driven slicing-by-8 (portable)
+inline uint32_t crc32_core_slice8(const uint32_t *data, uint32_t len) {
+    return detail::crc32_slice8(CRC32_INIT, reinterpret_cast<const uint8_t *>(data), size_t(len) * 4);
+}
+
+// Best implementation for the running CPU, selected once on first use
+inline uint32_t crc32_core_fast(const uint32_t *data, uint32_t len) {
+    static const detail::Crc32Fn fn = detail::crc32_select();
+    return fn(CRC32_INIT, reinterpret_cast<const uint8_t *>(data), size_t(len) * 4);
+}
+
+// Serialize LowCmd fields into LOWCMD_CRC_WORDS padding-free words (floats as raw bits)
+inline void pack_lowcmd_words(const LowCmd &cmd, uint32_t *words) {
+    words[0] = static_cast<uint32_t>(cmd.kinematic_mode());
+    uint32_t *w = words + 1;
+    for (const auto &m : cmd.motors()) {
+        const float f[5] = {m.q(), m.dq(), m.tau(), m.kp(), m.kd()};
+        w[0]             = m.id();
+        std::memcpy(w + 1, f, sizeof(f));
+        w += 6;
+    }
+}
+
+// CRC of a LowCmd, independent of struct padding
+inline uint32_t crc32_lowcmd(const LowCmd &cmd) {
+    uint32_t words[LOWCMD_CRC_WORDS];
+    pack_lowcmd_words(cmd, words);
+    return crc32_core_fast(words, LOWCMD_CRC_WORDS);
+}
+
+}  // namespace igris_sdk
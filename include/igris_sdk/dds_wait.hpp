@@ -0,0 +1,30 @@
+#pragma once
+
+#include <chrono>
+#include <dds/dds.hpp>
+
+namespace igris_sdk {
+namespace detail {
+
+// Block on a DDS condition until done() holds or timeout_ms passes.
+// done() is checked before waiting and after every wake-up (not after a timeout),
+// so status conditions re-arm by reading their status inside done().
+template <typename Done> bool wait_for_condition(const dds::core::cond::Condition &cond, Done done, int timeout_ms) {
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeout_ms);
+
+    dds::core::cond::WaitSet waitset;
+    waitset.attach_condition(cond);
+    while (!done()) {
+        auto remaining = std::chrono::duration_cast<std::chrono::microseconds>(deadline - std::chrono::steady_clock::now());
+        if (remaining.count() <= 0) return false;
+        try {
+            waitset.wait(dds::core::Duration::from_microsecs(remaining.count()));
+        } catch (const dds::core::TimeoutError &) {
+            return false;
+        }
+    }
+    return true;
+}
+
+}  // namespace detail
+}  // namespace igris_sdk
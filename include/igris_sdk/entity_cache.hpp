@@ -0,0 +1,134 @@
+#pragma once
+
+#include <dds/dds.hpp>
+#include <iterator>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <tuple>
+#include <typeindex>
+#include <vector>
+
+namespace igris_sdk {
+
+/**
+ * @brief Shares Topic, Publisher and Subscriber entities between endpoints
+ *
+ * Every endpoint otherwise creates its own Topic and its own Publisher or
+ * Subscriber entity. The cache hands out one entity per participant and
+ * (type, topic name) for topics, and per participant and QoS for publishers and
+ * subscribers, which saves entity creation time and memory when an application
+ * opens many endpoints.
+ *
+ * Entries are weak: an entity lives as long as an endpoint holds it and is
+ * created again on the next request after that, so the cache never keeps a
+ * participant alive across ChannelFactory::Release().
+ *
+ * Publisher<T>/Subscriber<T> use this cache in init(ChannelFactory &) and, for
+ * custom message types (publisher_impl.hpp / subscriber_impl.hpp), in init();
+ * init() of the built-in types in libigris_sdk.a creates its own entities.
+ *
+ * Thread-safe.
+ *
+ * Example:
+ * @code
+ * auto participant = ChannelFactory::Instance()->GetParticipant();
+ * auto topic       = EntityCache::Instance().topic<LowState>(*participant, "rt/lowstate");
+ * auto subscriber  = EntityCache::Instance().subscriber(*participant);
+ * @endcode
+ */
+class EntityCache {
+  public:
+    static EntityCache &Instance() {
+        static EntityCache cache;
+        return cache;
+    }
+
+    // Topic of type T named name, created on first use
+    template <typename T> std::shared_ptr<dds::topic::Topic<T>> topic(const dds::domain::DomainParticipant &participant, const std::string &name) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        TopicKey key(participant.delegate().get(), std::type_index(typeid(T)), name);
+        auto it = topics_.find(key);
+        if (it != topics_.end()) {
+            if (auto topic = std::static_pointer_cast<dds::topic::Topic<T>>(it->second.lock())) return topic;
+        }
+        // Prune expired topics before adding one, so released names do not accumulate
+        for (auto e = topics_.begin(); e != topics_.end();) {
+            e = e->second.expired() ? topics_.erase(e) : std::next(e);
+        }
+        auto topic   = std::make_shared<dds::topic::Topic<T>>(participant, name);
+        topics_[key] = topic;
+        return topic;
+    }
+
+    // Publisher entity with the given QoS, created on first use
+    std::shared_ptr<dds::pub::Publisher> publisher(const dds::domain::DomainParticipant &participant, const dds::pub::qos::PublisherQos &qos) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return lookup(publishers_, participant, qos);
+    }
+
+    // Publisher entity with the participant's default QoS
+    std::shared_ptr<dds::pub::Publisher> publisher(const dds::domain::DomainParticipant &participant) {
+        return publisher(participant, participant.default_publisher_qos());
+    }
+
+    // Subscriber entity with the given QoS, created on first use
+    std::shared_ptr<dds::sub::Subscriber> subscriber(const dds::domain::DomainParticipant &participant, const dds::sub::qos::SubscriberQos &qos) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return lookup(subscribers_, participant, qos);
+    }
+
+    // Subscriber entity with the participant's default QoS
+    std::shared_ptr<dds::sub::Subscriber> subscriber(const dds::domain::DomainParticipant &participant) {
+        return subscriber(participant, participant.default_subscriber_qos());
+    }
+
+    // Number of cached entities still in use
+    size_t size() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        size_t n = 0;
+        for (const auto &t : topics_) n += !t.second.expired();
+        for (const auto &p : publishers_) n += !p.entity.expired();
+        for (const auto &s : subscribers_) n += !s.entity.expired();
+        return n;
+    }
+
+  private:
+    using TopicKey = std::tuple<const void *, std::type_index, std::string>;
+
+    template <typename Entity, typename Qos> struct Entry {
+        const void *participant;
+        Qos qos;
+        std::weak_ptr<Entity> entity;
+    };
+
+    template <typename Entity, typename Qos>
+    static std::shared_ptr<Entity> lookup(std::vector<Entry<Entity, Qos>> &entries, const dds::domain::DomainParticipant &participant, const Qos &qos) {
+        const void *key = participant.delegate().get();
+        for (size_t i = 0; i < entries.size();) {
+            Entry<Entity, Qos> &e = entries[i];
+            auto entity           = e.entity.lock();
+            if (!entity) {
+                // Prune expired entries on the way
+                e = std::move(entries.back());
+                entries.pop_back();
+                continue;
+            }
+            if (e.participant == key && e.qos == qos) return entity;
+            i++;
+        }
+        auto entity = std::make_shared<Entity>(participant, qos);
+        entries.push_back({key, qos, entity});
+        return entity;
+    }
+
+    EntityCache() = default;
+
+    mutable std::mutex mutex_;
+    std::map<TopicKey, std::weak_ptr<void>> topics_;
+    std::vector<Entry<dds::pub::Publisher, dds::pub::qos::PublisherQos>> publishers_;
+    std::vector<Entry<dds::sub::Subscriber, dds::sub::qos::SubscriberQos>> subscribers_;
+};
+
+}  // namespace igris_sdk
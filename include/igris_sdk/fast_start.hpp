@@ -0,0 +1,201 @@
+#pragma once
+
+#include "igris_sdk/channel_factory.hpp"
+
+#include <cctype>
+#include <cstdint>
+#include <dds/dds.h>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace igris_sdk {
+
+/**
+ * @brief Configuration for FastStartDiscovery
+ */
+struct FastStartConfig {
+    std::vector<std::string> peers;  // Robot addresses (unicast SPDP); empty: peers_file, then multicast
+    std::string peers_file;          // Optional peer list: read when peers is empty, written by save_peers()
+    std::string network_interface;   // Interface name or address; empty: Cyclone's choice
+
+    uint32_t spdp_interval_ms = 100;    // SPDP resend period, so a lost first announcement costs 100ms, not 30s
+    int max_participant_index = 2;      // Participant indices (ports) probed on each peer, and local index limit
+    bool multicast_with_peers = false;  // Keep multicast discovery enabled when peers are known
+};
+
+/**
+ * @brief Fast-start discovery for tools that connect to a known robot
+ *
+ * ChannelFactory::Init() creates its participant with Cyclone's default (or
+ * CYCLONEDDS_URI) configuration: multicast SPDP, re-announced every 30 s. This
+ * class creates the DDS domain first with a configuration tuned for startup
+ * latency, and ChannelFactory's participant then joins that domain:
+ * - SPDP is sent by unicast straight to the robot's addresses (static peers),
+ *   with multicast disabled unless requested
+ * - SPDP is re-sent every spdp_interval_ms instead of every 30 s, so an
+ *   announcement lost while the robot was busy is retried quickly
+ *
+ * Cyclone cannot change the SPDP period at run time, so the short period lasts
+ * for the life of the domain: each peer gets max_participant_index + 1 unicast
+ * SPDP packets every spdp_interval_ms (30 packets/s per peer with the defaults,
+ * a few hundred bytes each), plus the robot's replies. Long-running processes
+ * should raise spdp_interval_ms to trade retry latency for traffic. max_participant_index
+ * also caps the participant index of this host, so at most
+ * max_participant_index + 1 fast-start processes can share the domain here.
+ *
+ * - The peer list can be kept in peers_file and is used when no peers are given.
+ *   save_peers() writes the peers in use once the robot has been matched; these
+ *   are the configured addresses, not ones learned from discovery (Cyclone does
+ *   not report the address a peer was matched on)
+ *
+ * Type lookup needs no setting: the bundled Cyclone only requests type
+ * information for types it cannot resolve locally, and all SDK message types are
+ * registered on both sides.
+ *
+ * Must be initialized before anything else creates a participant in the domain.
+ * release() (or the destructor) releases ChannelFactory and deletes the domain,
+ * so destroy all endpoints first.
+ *
+ * Example:
+ * @code
+ * FastStartConfig config;
+ * config.peers      = {"192.168.0.10"};
+ * config.peers_file = "/tmp/igris_peers";
+ * FastStartDiscovery fast_start(config);
+ * fast_start.init(domain_id);  // instead of ChannelFactory::Instance()->Init(domain_id)
+ * ...
+ * if (cmd_pub.wait_for_subscribers(1, 1000)) fast_start.save_peers();
+ * @endcode
+ */
+class FastStartDiscovery {
+  public:
+    explicit FastStartDiscovery(const FastStartConfig &config = FastStartConfig()) : config_(config) {}
+
+    ~FastStartDiscovery() { release(); }
+
+    FastStartDiscovery(const FastStartDiscovery &)            = delete;
+    FastStartDiscovery &operator=(const FastStartDiscovery &) = delete;
+
+    // Create the domain with the fast-start configuration, then initialize ChannelFactory
+    bool init(int32_t domain_id = 0);
+
+    // Cyclone XML configuration used by init()
+    std::string config_xml() const;
+
+    // Release ChannelFactory, then delete the domain created by init() (no-op if not initialized)
+    void release();
+
+    // Peers in use: configured, else loaded from peers_file
+    const std::vector<std::string> &peers() const { return peers_; }
+
+    // Write the peers in use to peers_file for the next run; call once the robot has been matched
+    bool save_peers() const;
+
+  private:
+    static std::vector<std::string> load_peers(const std::string &path);
+
+    FastStartConfig config_;
+    std::vector<std::string> peers_;
+    dds_entity_t domain_ = 0;
+};
+
+inline std::vector<std::string> FastStartDiscovery::load_peers(const std::string &path) {
+    std::vector<std::string> peers;
+    std::ifstream file(path);
+    std::string line;
+    while (std::getline(file, line)) {
+        line.erase(0, line.find_first_not_of(" \t"));
+        line.erase(line.find_last_not_of(" \t\r") + 1);
+        if (!line.empty() && line[0] != '#') peers.push_back(line);
+    }
+    return peers;
+}
+
+inline std::string FastStartDiscovery::config_xml() const {
+    const bool multicast = peers_.empty() || config_.multicast_with_peers;
+
+    std::ostringstream xml;
+    xml << "<CycloneDDS><Domain id=\"any\">";
+    xml << "<General>";
+    if (!config_.network_interface.empty()) {
+        // Addresses start with a digit, interface names (eth0, enp3s0) do not
+        bool address = std::isdigit(static_cast<unsigned char>(config_.network_interface[0]));
+        xml << "<Interfaces><NetworkInterface " << (address ? "address" : "name") << "=\"" << config_.network_interface << "\"/></Interfaces>";
+    }
+    xml << "<AllowMulticast>" << (multicast ? "default" : "false") << "</AllowMulticast>";
+    xml << "</General>";
+    xml << "<Discovery>";
+    if (!peers_.empty()) {
+        xml << "<Peers>";
+        for (const std::string &peer : peers_) xml << "<Peer address=\"" << peer << "\"/>";
+        xml << "</Peers>";
+        xml << "<ParticipantIndex>auto</ParticipantIndex>";
+        xml << "<MaxAutoParticipantIndex>" << config_.max_participant_index << "</MaxAutoParticipantIndex>";
+    }
+    xml << "<SPDPInterval>" << config_.spdp_interval_ms << "ms</SPDPInterval>";
+    xml << "</Discovery>";
+    xml << "</Domain></CycloneDDS>";
+    return xml.str();
+}
+
+inline bool FastStartDiscovery::init(int32_t domain_id) {
+    if (domain_ > 0) {
+        std::cerr << "[FastStart] Already initialized" << std::endl;
+        return false;
+    }
+
+    peers_ = config_.peers;
+    if (peers_.empty() && !config_.peers_file.empty()) {
+        peers_ = load_peers(config_.peers_file);
+        if (!peers_.empty()) std::cout << "[FastStart] Using peers from " << config_.peers_file << std::endl;
+    }
+
+    const std::string xml = config_xml();
+    dds_entity_t domain   = dds_create_domain(static_cast<dds_domainid_t>(domain_id), xml.c_str());
+    if (domain < 0) {
+        // Typically the domain already exists (a participant was created before init())
+        std::cerr << "[FastStart] Failed to create domain " << domain_id << ": " << dds_strretcode(domain) << std::endl;
+        return false;
+    }
+    domain_ = domain;
+
+    ChannelFactory::Instance()->Init(domain_id);
+    if (!ChannelFactory::Instance()->IsInitialized()) {
+        std::cerr << "[FastStart] ChannelFactory initialization failed" << std::endl;
+        dds_delete(domain_);
+        domain_ = 0;
+        return false;
+    }
+
+    std::cout << "[FastStart] Domain " << domain_id << " initialized with " << peers_.size() << " peer(s), SPDP every "
+              << config_.spdp_interval_ms << "ms" << std::endl;
+    return true;
+}
+
+inline void FastStartDiscovery::release() {
+    if (domain_ <= 0) return;
+
+    // The participant lives in the domain, so it goes first
+    ChannelFactory::Instance()->Release();
+    dds_return_t ret = dds_delete(domain_);
+    if (ret < 0) std::cerr << "[FastStart] Failed to delete domain: " << dds_strretcode(ret) << std::endl;
+    domain_ = 0;
+}
+
+inline bool FastStartDiscovery::save_peers() const {
+    if (config_.peers_file.empty() || peers_.empty()) return false;
+
+    std::ofstream file(config_.peers_file, std::ios::trunc);
+    if (!file) {
+        std::cerr << "[FastStart] Cannot write peers file: " << config_.peers_file << std::endl;
+        return false;
+    }
+    file << "# igris_sdk fast-start peers\n";
+    for (const std::string &peer : peers_) file << peer << "\n";
+    return static_cast<bool>(file);
+}
+
+}  // namespace igris_sdk
@@ -6,9 +6,11 @@
 #include "igris_sdk/subscriber.hpp"
 
 #include <future>
+#include <iostream>
 #include <map>
 #include <memory>
 #include <mutex>
+#include <stdexcept>
 #include <string>
 
 namespace igris_sdk {
@@ -37,9 +39,16 @@ class IgrisC_Client {
     /**
      * @brief Initialize client
      * @note Must call ChannelFactory::Instance()->Init() first
+     * @note Ignores ChannelFactory::SetPartition(); use Init(*ChannelFactory::Instance()) for a partition
      */
     void Init();
 
+    /**
+     * @brief Initialize client on a given factory instead of ChannelFactory::Instance()
+     * @note For processes talking to several robots: one ChannelFactory (domain) per robot
+     */
+    void Init(ChannelFactory &factory);
+
     /**
      * @brief Set timeout for operations
      * @param timeout_sec Timeout in seconds
@@ -72,12 +81,30 @@ class IgrisC_Client {
      */
     igris_c::msg::dds::ServiceResponse SetControlMode(igris_c::msg::dds::ControlMode mode, int timeout_ms = 5000);
 
-  private:
-    // ========== Internal Async Implementation ==========
+    // ========== Service API (Asynchronous) ==========
+
+    /**
+     * @brief Send a BMS/Motor init request without waiting
+     * @param init_type BMS_INIT, MOTOR_INIT, or BMS_AND_MOTOR_INIT
+     * @return Future completed by the response subscriber (no timeout; see AsyncServiceClient)
+     */
     std::future<igris_c::msg::dds::ServiceResponse> InitBmsAsync(igris_c::msg::dds::BmsInitType init_type);
+
+    /**
+     * @brief Send a torque on/off request without waiting
+     * @param torque TORQUE_ON or TORQUE_OFF
+     * @return Future completed by the response subscriber (no timeout; see AsyncServiceClient)
+     */
     std::future<igris_c::msg::dds::ServiceResponse> SetTorqueAsync(igris_c::msg::dds::TorqueType torque);
+
+    /**
+     * @brief Send a control mode request without waiting
+     * @param mode CONTROL_MODE_LOW_LEVEL or CONTROL_MODE_HIGH_LEVEL
+     * @return Future completed by the response subscriber (no timeout; see AsyncServiceClient)
+     */
     std::future<igris_c::msg::dds::ServiceResponse> SetControlModeAsync(igris_c::msg::dds::ControlMode mode);
 
+  private:
     bool initialized_;
     float timeout_;
 
@@ -106,4 +133,35 @@ class IgrisC_Client {
     std::string generateRequestId();
 };
 
+inline void IgrisC_Client::Init(ChannelFactory &factory) {
+    if (!factory.IsInitialized()) {
+        std::cerr << "[IgrisC_Client] Error: ChannelFactory not initialized. Call Init() first." << std::endl;
+        return;
+    }
+    if (initialized_) return;
+
+    bms_init_req_pub_ = std::make_unique<Publisher<igris_c::msg::dds::BmsInitCmd>>("rt/service/bms_init/request");
+    if (!bms_init_req_pub_->init(factory)) throw std::runtime_error("Failed to initialize BmsInit request publisher");
+    torque_req_pub_ = std::make_unique<Publisher<igris_c::msg::dds::TorqueCmd>>("rt/service/torque/request");
+    if (!torque_req_pub_->init(factory)) throw std::runtime_error("Failed to initialize Torque request publisher");
+    control_mode_req_pub_ = std::make_unique<Publisher<igris_c::msg::dds::ControlModeCmd>>("rt/service/control_mode/request");
+    if (!control_mode_req_pub_->init(factory)) throw std::runtime_error("Failed to initialize ControlMode request publisher");
+
+    bms_init_res_sub_ = std::make_unique<Subscriber<igris_c::msg::dds::ServiceResponse>>("rt/service/bms_init/response");
+    if (!bms_init_res_sub_->init(factory, [this](const igris_c::msg::dds::ServiceResponse &res) { bmsInitResponseCallback(res); })) {
+        throw std::runtime_error("Failed to initialize BmsInit response subscriber");
+    }
+    torque_res_sub_ = std::make_unique<Subscriber<igris_c::msg::dds::ServiceResponse>>("rt/service/torque/response");
+    if (!torque_res_sub_->init(factory, [this](const igris_c::msg::dds::ServiceResponse &res) { torqueResponseCallback(res); })) {
+        throw std::runtime_error("Failed to initialize Torque response subscriber");
+    }
+    control_mode_res_sub_ = std::make_unique<Subscriber<igris_c::msg::dds::ServiceResponse>>("rt/service/control_mode/response");
+    if (!control_mode_res_sub_->init(factory, [this](const igris_c::msg::dds::ServiceResponse &res) { controlModeResponseCallback(res); })) {
+        throw std::runtime_error("Failed to initialize ControlMode response subscriber");
+    }
+
+    initialized_ = true;
+    std::cout << "[IgrisC_Client] Service API initialized" << std::endl;
+}
+
 }  // namespace igris_sdk
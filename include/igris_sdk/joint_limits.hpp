@@ -0,0 +1,75 @@
+#pragma once
+
+#include "igris_sdk/joint_math.hpp"
+#include "igris_sdk/types.hpp"
+
+namespace igris_sdk {
+
+// Position limits (rad) from params.yaml, in LowCmd/LowState index order.
+// JOINT_* apply in PJS mode (parallel joint space), MOTOR_* in MS mode (motor space);
+// they differ only for the parallel mechanisms (waist 1-2, ankles 7-8/13-14, wrists 20-21/27-28).
+
+inline constexpr JointArray JOINT_POS_MAX = {
+    1.57f,                                                   // Waist_Yaw
+    0.310f, 0.28f,                                           // Waist_Roll, Waist_Pitch
+    0.480f, 2.300f, 1.570f, 2.280f, 0.698f, 0.349f,          // Left leg
+    0.480f, 0.330f, 1.570f, 2.280f, 0.698f, 0.349f,          // Right leg
+    1.047f, 3.140f, 1.570f, 0.0f,   1.570f, 0.870f, 0.650f,  // Left arm
+    1.047f, 0.170f, 1.570f, 0.0f,   1.570f, 1.221f, 0.650f,  // Right arm
+    1.221f, 0.520f                                           // Neck
+};
+
+inline constexpr JointArray JOINT_POS_MIN = {
+    -1.57f,                                                       // Waist_Yaw
+    -0.310f, -0.87f,                                              // Waist_Roll, Waist_Pitch
+    -2.000f, -0.330f, -1.570f, 0.0f,  -0.70f,  -0.350f,           // Left leg
+    -2.000f, -2.300f, -1.570f, 0.0f,  -0.70f,  -0.350f,           // Right leg
+    -3.141f, -0.170f, -1.570f, -2.0f, -1.570f, -1.221f, -0.650f,  // Left arm
+    -3.141f, -3.140f, -1.570f, -2.0f, -1.570f, -0.870f, -0.650f,  // Right arm
+    -1.221f, -0.520f                                              // Neck
+};
+
+inline constexpr JointArray MOTOR_POS_MAX = {
+    1.57f,                                                  // Waist_Yaw
+    0.87f,  0.87f,                                          // Waist_L, Waist_R
+    0.480f, 2.300f, 1.570f, 2.280f, 0.609f, 0.523f,         // Left leg
+    0.480f, 0.330f, 1.570f, 2.280f, 0.609f, 0.523f,         // Right leg
+    1.047f, 3.140f, 1.570f, 0.0f,   1.570f, 0.75f,  0.75f,  // Left arm
+    1.047f, 0.170f, 1.570f, 0.0f,   1.570f, 0.98f,  0.98f,  // Right arm
+    1.221f, 0.520f                                          // Neck
+};
+
+inline constexpr JointArray MOTOR_POS_MIN = {
+    -1.57f,                                                      // Waist_Yaw
+    -0.34f,  -0.34f,                                             // Waist_L, Waist_R
+    -2.000f, -0.330f, -1.570f, 0.0f,  -0.630f, -0.617f,          // Left leg
+    -2.000f, -2.300f, -1.570f, 0.0f,  -0.630f, -0.617f,          // Right leg
+    -3.141f, -0.170f, -1.570f, -2.0f, -1.570f, -0.98f,  -0.98f,  // Left arm
+    -3.141f, -3.140f, -1.570f, -2.0f, -1.570f, -0.75f,  -0.75f,  // Right arm
+    -1.221f, -0.520f                                             // Neck
+};
+
+// Default PD gains of the examples (same index order), e.g. for holding a joint in place
+inline constexpr JointArray DEFAULT_KP = {
+    50.0f,  25.0f,  25.0f,                               // Waist
+    500.0f, 200.0f, 50.0f, 500.0f, 300.0f, 300.0f,       // Left leg
+    500.0f, 200.0f, 50.0f, 500.0f, 300.0f, 300.0f,       // Right leg
+    50.0f,  50.0f,  30.0f, 30.0f,  5.0f,   5.0f,   5.0f,  // Left arm
+    50.0f,  50.0f,  30.0f, 30.0f,  5.0f,   5.0f,   5.0f,  // Right arm
+    2.0f,   5.0f                                         // Neck
+};
+
+inline constexpr JointArray DEFAULT_KD = {
+    0.8f,  0.8f, 0.8f,                             // Waist
+    3.0f,  0.5f, 0.5f,  3.0f,  1.5f, 1.5f,         // Left leg
+    3.0f,  0.5f, 0.5f,  3.0f,  1.5f, 1.5f,         // Right leg
+    0.5f,  0.5f, 0.15f, 0.15f, 0.1f, 0.1f, 0.1f,   // Left arm
+    0.5f,  0.5f, 0.15f, 0.15f, 0.1f, 0.1f, 0.1f,   // Right arm
+    0.05f, 0.1f                                    // Neck
+};
+
+// Position limits for the given kinematic mode
+inline const JointArray &pos_max(KinematicMode mode) { return mode == KinematicMode::MS ? MOTOR_POS_MAX : JOINT_POS_MAX; }
+inline const JointArray &pos_min(KinematicMode mode) { return mode == KinematicMode::MS ? MOTOR_POS_MIN : JOINT_POS_MIN; }
+
+}  // namespace igris_sdk
@@ -0,0 +1,276 @@
+#pragma once
+
+#include "igris_sdk/types.hpp"
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+#if defined(__AVX__)
+#include <immintrin.h>
+#define IGRIS_SDK_JOINT_MATH_AVX 1
+#elif defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define IGRIS_SDK_JOINT_MATH_SSE 1
+#endif
+
+namespace igris_sdk {
+
+// Batched versions of the scalar helpers in utils.hpp, applied across all joints at once.
+//
+// The SIMD width is chosen at compile time (AVX: 8 lanes, SSE2: 4 lanes, otherwise scalar),
+// so everything inlines into the caller's control loop. Build with -mavx2 (or
+// -march=x86-64-v3) to get the 8-lane path. Results are bit-exact with lerp(), clamp(),
+// deg2rad() and rad2deg() from utils.hpp: products are kept out of FMA contraction
+// (which GCC applies by default when FMA is enabled), see detail::no_contract().
+
+// One float per joint, in LowCmd/LowState index order
+using JointArray = std::array<float, N_JOINTS>;
+
+namespace detail {
+
+// Opaque to the optimizer: a product passed through here cannot be fused with the
+// following add/sub into an FMA, so results match the separately rounded mul + add
+// of utils.cpp (built without FMA) whatever -march/-ffp-contract the caller uses
+template <typename T> inline T no_contract(T v) {
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+    asm("" : "+x"(v));
+#elif defined(__GNUC__) && defined(__aarch64__)
+    asm("" : "+w"(v));
+#elif defined(__GNUC__)
+    asm("" : "+m"(v));
+#endif
+    return v;
+}
+
+}  // namespace detail
+
+// Wrap angle to [-pi, pi) (float pi)
+inline float wrap_to_pi(float rad) {
+    constexpr float PI      = 3.14159265358979323846f;
+    constexpr float TWO_PI  = 6.28318530717958647692f;
+    constexpr float INV_2PI = 0.15915494309189533577f;
+    float turns             = std::floor((rad + PI) * INV_2PI);
+    float r                 = rad - detail::no_contract(turns * TWO_PI);
+    // Rounding near +-pi can land a few ulps outside the range; those are -pi
+    if (r >= PI) r = -PI;
+    return r < -PI ? -PI : r;
+}
+
+namespace detail {
+
+#if defined(IGRIS_SDK_JOINT_MATH_AVX)
+
+struct JointSimd {
+    using F                 = __m256;
+    static constexpr size_t W = 8;
+    static F load(const float *p) { return _mm256_loadu_ps(p); }
+    static void store(float *p, F v) { _mm256_storeu_ps(p, v); }
+    static F set1(float x) { return _mm256_set1_ps(x); }
+    static F add(F a, F b) { return _mm256_add_ps(a, b); }
+    static F sub(F a, F b) { return _mm256_sub_ps(a, b); }
+    static F mul(F a, F b) { return _mm256_mul_ps(a, b); }
+    static F div(F a, F b) { return _mm256_div_ps(a, b); }
+    static F min(F a, F b) { return _mm256_min_ps(a, b); }
+    static F max(F a, F b) { return _mm256_max_ps(a, b); }
+    static F sqrt(F a) { return _mm256_sqrt_ps(a); }
+    // a >= b ? x : y
+    static F select_ge(F a, F b, F x, F y) { return _mm256_blendv_ps(y, x, _mm256_cmp_ps(a, b, _CMP_GE_OQ)); }
+    static F floor(F a) { return _mm256_floor_ps(a); }
+    // (float)((double)x * m / d), evaluated in double like the scalar helpers
+    static F scale_pd(F x, double m, double d) {
+        __m256d lo = _mm256_cvtps_pd(_mm256_castps256_ps128(x));
+        __m256d hi = _mm256_cvtps_pd(_mm256_extractf128_ps(x, 1));
+        lo         = _mm256_div_pd(_mm256_mul_pd(lo, _mm256_set1_pd(m)), _mm256_set1_pd(d));
+        hi         = _mm256_div_pd(_mm256_mul_pd(hi, _mm256_set1_pd(m)), _mm256_set1_pd(d));
+        return _mm256_insertf128_ps(_mm256_castps128_ps256(_mm256_cvtpd_ps(lo)), _mm256_cvtpd_ps(hi), 1);
+    }
+};
+
+#elif defined(IGRIS_SDK_JOINT_MATH_SSE)
+
+struct JointSimd {
+    using F                 = __m128;
+    static constexpr size_t W = 4;
+    static F load(const float *p) { return _mm_loadu_ps(p); }
+    static void store(float *p, F v) { _mm_storeu_ps(p, v); }
+    static F set1(float x) { return _mm_set1_ps(x); }
+    static F add(F a, F b) { return _mm_add_ps(a, b); }
+    static F sub(F a, F b) { return _mm_sub_ps(a, b); }
+    static F mul(F a, F b) { return _mm_mul_ps(a, b); }
+    static F div(F a, F b) { return _mm_div_ps(a, b); }
+    static F min(F a, F b) { return _mm_min_ps(a, b); }
+    static F max(F a, F b) { return _mm_max_ps(a, b); }
+    static F sqrt(F a) { return _mm_sqrt_ps(a); }
+    static F select_ge(F a, F b, F x, F y) {
+        F m = _mm_cmpge_ps(a, b);
+        return _mm_or_ps(_mm_and_ps(m, x), _mm_andnot_ps(m, y));
+    }
+    // SSE2 has no roundps; truncate and correct negatives (|a| < 2^31 holds for any sane angle)
+    static F floor(F a) {
+        F t = _mm_cvtepi32_ps(_mm_cvttps_epi32(a));
+        return _mm_sub_ps(t, _mm_and_ps(_mm_cmpgt_ps(t, a), _mm_set1_ps(1.0f)));
+    }
+    static F scale_pd(F x, double m, double d) {
+        __m128d lo = _mm_cvtps_pd(x);
+        __m128d hi = _mm_cvtps_pd(_mm_movehl_ps(x, x));
+        lo         = _mm_div_pd(_mm_mul_pd(lo, _mm_set1_pd(m)), _mm_set1_pd(d));
+        hi         = _mm_div_pd(_mm_mul_pd(hi, _mm_set1_pd(m)), _mm_set1_pd(d));
+        return _mm_movelh_ps(_mm_cvtpd_ps(lo), _mm_cvtpd_ps(hi));
+    }
+};
+
+#endif
+
+// Scalar stand-in with the JointSimd interface (min/max follow the SSE operand order)
+struct JointScalar {
+    using F                   = float;
+    static constexpr size_t W = 1;
+    static F load(const float *p) { return *p; }
+    static void store(float *p, F v) { *p = v; }
+    static F set1(float x) { return x; }
+    static F add(F a, F b) { return a + b; }
+    static F sub(F a, F b) { return a - b; }
+    static F mul(F a, F b) { return a * b; }
+    static F div(F a, F b) { return a / b; }
+    static F min(F a, F b) { return a < b ? a : b; }
+    static F max(F a, F b) { return a > b ? a : b; }
+    static F sqrt(F a) { return std::sqrt(a); }
+    static F select_ge(F a, F b, F x, F y) { return a >= b ? x : y; }
+};
+
+// Widest vector type available, for code written once over the JointSimd interface
+#if defined(IGRIS_SDK_JOINT_MATH_AVX) || defined(IGRIS_SDK_JOINT_MATH_SSE)
+using JointVec = JointSimd;
+#else
+using JointVec = JointScalar;
+#endif
+
+constexpr double DEG2RAD_NUM = 3.14159265358979323846;
+constexpr double DEG2RAD_DEN = 180.0;
+
+// Scalar reference forms (same operation order as utils.cpp)
+inline float lerp_one(float a, float b, float t) { return a + no_contract((b - a) * t); }
+inline float clamp_one(float v, float lo, float hi) { return lo > v ? lo : (hi < v ? hi : v); }
+inline float deg2rad_one(float deg) { return static_cast<float>(static_cast<double>(deg) * DEG2RAD_NUM / DEG2RAD_DEN); }
+inline float rad2deg_one(float rad) { return static_cast<float>(static_cast<double>(rad * 180.0f) / DEG2RAD_NUM); }
+
+}  // namespace detail
+
+// ========== Span versions (any length, no alignment requirement) ==========
+
+// out[i] = start[i] + (end[i] - start[i]) * t
+inline void lerp_joints(const float *start, const float *end, float t, float *out, size_t n) {
+    size_t i = 0;
+#if defined(IGRIS_SDK_JOINT_MATH_AVX) || defined(IGRIS_SDK_JOINT_MATH_SSE)
+    using S   = detail::JointSimd;
+    S::F vt   = S::set1(t);
+    for (; i + S::W <= n; i += S::W) {
+        S::F a = S::load(start + i);
+        S::store(out + i, S::add(a, detail::no_contract(S::mul(S::sub(S::load(end + i), a), vt))));
+    }
+#endif
+    for (; i < n; i++) {
+        out[i] = detail::lerp_one(start[i], end[i], t);
+    }
+}
+
+// out[i] = clamp(values[i], min[i], max[i]); NaN inputs pass through unchanged
+inline void clamp_joints(const float *values, const float *min, const float *max, float *out, size_t n) {
+    size_t i = 0;
+#if defined(IGRIS_SDK_JOINT_MATH_AVX) || defined(IGRIS_SDK_JOINT_MATH_SSE)
+    using S = detail::JointSimd;
+    for (; i + S::W <= n; i += S::W) {
+        S::F v = S::min(S::load(max + i), S::load(values + i));
+        S::store(out + i, S::max(S::load(min + i), v));
+    }
+#endif
+    for (; i < n; i++) {
+        out[i] = detail::clamp_one(values[i], min[i], max[i]);
+    }
+}
+
+// out[i] = wrap_to_pi(rad[i])
+inline void wrap_to_pi_joints(const float *rad, float *out, size_t n) {
+    size_t i = 0;
+#if defined(IGRIS_SDK_JOINT_MATH_AVX) || defined(IGRIS_SDK_JOINT_MATH_SSE)
+    using S                 = detail::JointSimd;
+    constexpr float PI      = 3.14159265358979323846f;
+    constexpr float TWO_PI  = 6.28318530717958647692f;
+    constexpr float INV_2PI = 0.15915494309189533577f;
+    for (; i + S::W <= n; i += S::W) {
+        S::F x     = S::load(rad + i);
+        S::F turns = S::floor(S::mul(S::add(x, S::set1(PI)), S::set1(INV_2PI)));
+        S::F r     = S::sub(x, detail::no_contract(S::mul(turns, S::set1(TWO_PI))));
+        r          = S::select_ge(r, S::set1(PI), S::set1(-PI), r);
+        S::store(out + i, S::max(S::set1(-PI), r));  // NaN passes through like the scalar version
+    }
+#endif
+    for (; i < n; i++) {
+        out[i] = wrap_to_pi(rad[i]);
+    }
+}
+
+// out[i] = deg2rad(deg[i])
+inline void deg2rad_joints(const float *deg, float *out, size_t n) {
+    size_t i = 0;
+#if defined(IGRIS_SDK_JOINT_MATH_AVX) || defined(IGRIS_SDK_JOINT_MATH_SSE)
+    using S = detail::JointSimd;
+    for (; i + S::W <= n; i += S::W) {
+        S::store(out + i, S::scale_pd(S::load(deg + i), detail::DEG2RAD_NUM, detail::DEG2RAD_DEN));
+    }
+#endif
+    for (; i < n; i++) {
+        out[i] = detail::deg2rad_one(deg[i]);
+    }
+}
+
+// out[i] = rad2deg(rad[i])
+inline void rad2deg_joints(const float *rad, float *out, size_t n) {
+    size_t i = 0;
+#if defined(IGRIS_SDK_JOINT_MATH_AVX) || defined(IGRIS_SDK_JOINT_MATH_SSE)
+    using S = detail::JointSimd;
+    for (; i + S::W <= n; i += S::W) {
+        S::F x = S::mul(S::load(rad + i), S::set1(180.0f));
+        S::store(out + i, S::scale_pd(x, 1.0, detail::DEG2RAD_NUM));
+    }
+#endif
+    for (; i < n; i++) {
+        out[i] = detail::rad2deg_one(rad[i]);
+    }
+}
+
+// ========== JointArray versions ==========
+
+inline JointArray lerp_joints(const JointArray &start, const JointArray &end, float t) {
+    JointArray out;
+    lerp_joints(start.data(), end.data(), t, out.data(), out.size());
+    return out;
+}
+
+inline JointArray clamp_joints(const JointArray &values, const JointArray &min, const JointArray &max) {
+    JointArray out;
+    clamp_joints(values.data(), min.data(), max.data(), out.data(), out.size());
+    return out;
+}
+
+inline JointArray wrap_to_pi_joints(const JointArray &rad) {
+    JointArray out;
+    wrap_to_pi_joints(rad.data(), out.data(), out.size());
+    return out;
+}
+
+inline JointArray deg2rad_joints(const JointArray &deg) {
+    JointArray out;
+    deg2rad_joints(deg.data(), out.data(), out.size());
+    return out;
+}
+
+inline JointArray rad2deg_joints(const JointArray &rad) {
+    JointArray out;
+    rad2deg_joints(rad.data(), out.data(), out.size());
+    return out;
+}
+
+}  // namespace igris_sdk
@@ -0,0 +1,493 @@
+#pragma once
+
+#include "igris_sdk/joint_math.hpp"
+#include "igris_sdk/types.hpp"
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+
+namespace igris_sdk {
+
+// Motor space (MS) <-> parallel joint space (PJS) conversion on the client.
+//
+// Every joint is driven 1:1 by its motor except the parallel mechanisms below, where two
+// motors drive two joints together (same indices in both spaces):
+//
+//   pair 0: Waist_L/R         <-> Waist_Roll/Pitch       (1, 2)
+//   pair 1: Ankle_Out/In_L    <-> Ankle_Pitch/Roll_L     (7, 8)
+//   pair 2: Ankle_Out/In_R    <-> Ankle_Pitch/Roll_R     (13, 14)
+//   pair 3: Wrist_Front/Back_L <-> Wrist_Roll/Pitch_L    (20, 21)
+//   pair 4: Wrist_Front/Back_R <-> Wrist_Roll/Pitch_R    (27, 28)
+//
+// The linkage geometry is not published, so each pair is modelled as a quadratic map from
+// motor to joint angles (LinkageModel), which covers differentials exactly and linkages to
+// second order. The default models are unit differentials (difference -> roll, sum ->
+// pitch); they are placeholders, not robot data, so a KinematicTransform refuses to
+// produce motor-space commands until every pair has a model from set_model().
+// LowState carries both motor_state and joint_state, so fit the real mapping once with
+// LinkageCalibrator, which installs it with set_model().
+
+constexpr size_t N_PARALLEL_PAIRS = 5;
+
+// {first, second} index of each parallel mechanism
+inline constexpr std::array<std::array<uint16_t, 2>, N_PARALLEL_PAIRS> PARALLEL_PAIRS = {{{1, 2}, {7, 8}, {13, 14}, {20, 21}, {27, 28}}};
+
+/**
+ * @brief Motor-to-joint map of one parallel pair
+ *
+ * q_joint[k] = c[k] + a[k][0] m0 + a[k][1] m1 + b[k][0] m0^2 + b[k][1] m0 m1 + b[k][2] m1^2
+ * where (m0, m1) are the motor angles at the pair's first and second index.
+ */
+struct LinkageModel {
+    float c[2]    = {0.0f, 0.0f};
+    float a[2][2] = {{1.0f, 0.0f}, {0.0f, 1.0f}};
+    float b[2][3] = {{0.0f, 0.0f, 0.0f}, {0.0f, 0.0f, 0.0f}};
+
+    // q_joint = A q_motor
+    static LinkageModel linear(float a00, float a01, float a10, float a11) {
+        LinkageModel m;
+        m.a[0][0] = a00;
+        m.a[0][1] = a01;
+        m.a[1][0] = a10;
+        m.a[1][1] = a11;
+        return m;
+    }
+};
+
+// Assumed unit differentials for all pairs (placeholders, not robot data)
+inline std::array<LinkageModel, N_PARALLEL_PAIRS> differential_linkage_models() {
+    return {{
+        LinkageModel::linear(0.5f, -0.5f, -0.5f, -0.5f),  // Waist Roll = (L - R) / 2, Pitch = -(L + R) / 2
+        LinkageModel::linear(0.5f, 0.5f, 0.5f, -0.5f),    // Ankle L Pitch = (Out + In) / 2, Roll = (Out - In) / 2
+        LinkageModel::linear(0.5f, 0.5f, 0.5f, -0.5f),    // Ankle R
+        LinkageModel::linear(0.5f, -0.5f, 0.5f, 0.5f),    // Wrist L Roll = (Front - Back) / 2, Pitch = (Front + Back) / 2
+        LinkageModel::linear(0.5f, -0.5f, 0.5f, 0.5f),    // Wrist R
+    }};
+}
+
+// d q_joint / d q_motor of one pair: j[k][i] = d joint_k / d motor_i
+struct PairJacobian {
+    float j[2][2];
+};
+
+namespace detail {
+
+// f(m) and its Jacobian for one vector of pairs
+template <typename S> struct LinkageEval {
+    typename S::F f0, f1, j00, j01, j10, j11;
+
+    LinkageEval(const float (*coef)[8], size_t i, typename S::F m0, typename S::F m1) {
+        // Coefficient order: c0, c1, a00, a01, a10, a11, b00, b01, b02, b10, b11, b12
+        using F = typename S::F;
+        auto c  = [&](int k) { return S::load(coef[k] + i); };
+        F two   = S::set1(2.0f);
+        F m00 = S::mul(m0, m0), m01 = S::mul(m0, m1), m11 = S::mul(m1, m1);
+        f0  = S::add(S::add(c(0), S::add(S::mul(c(2), m0), S::mul(c(3), m1))),
+                     S::add(S::mul(c(6), m00), S::add(S::mul(c(7), m01), S::mul(c(8), m11))));
+        f1  = S::add(S::add(c(1), S::add(S::mul(c(4), m0), S::mul(c(5), m1))),
+                     S::add(S::mul(c(9), m00), S::add(S::mul(c(10), m01), S::mul(c(11), m11))));
+        j00 = S::add(c(2), S::add(S::mul(S::mul(two, c(6)), m0), S::mul(c(7), m1)));
+        j01 = S::add(c(3), S::add(S::mul(c(7), m0), S::mul(S::mul(two, c(8)), m1)));
+        j10 = S::add(c(4), S::add(S::mul(S::mul(two, c(9)), m0), S::mul(c(10), m1)));
+        j11 = S::add(c(5), S::add(S::mul(c(10), m0), S::mul(S::mul(two, c(11)), m1)));
+    }
+};
+
+}  // namespace detail
+
+/**
+ * @brief Vectorized MS <-> PJS transform for positions, velocities and torques
+ *
+ * - Positions: q_joint = f(q_motor); the inverse uses a few Newton steps seeded from
+ *   the linear part of the model.
+ * - Velocities: dq_joint = J dq_motor, with J = df/dq_motor at the motor position.
+ * - Torques (virtual work): tau_motor = J^T tau_joint.
+ *
+ * All five pairs are evaluated together on SIMD lanes; non-parallel joints are copied.
+ *
+ * A default-constructed transform uses the placeholder differentials: motor_to_joint()
+ * gives an approximate reading, but joint_to_motor() and convert() return false until
+ * every pair has been calibrated (set_model() or LinkageCalibrator::fit()).
+ *
+ * Example:
+ * @code
+ * LinkageCalibrator cal;
+ * cal.add_sample(state);  // for each LowState while sweeping the mechanisms
+ * KinematicTransform kin;
+ * cal.fit(kin);
+ * JointArray q, dq, tau;
+ * kin.joint_state_from_motors(state, q, dq, tau);  // PJS from the motor readings
+ * kin.convert(cmd, KinematicMode::MS);              // false while uncalibrated
+ * @endcode
+ */
+class KinematicTransform {
+  public:
+    // Placeholder differentials; uncalibrated until set_model() is called for every pair
+    KinematicTransform() {
+        const auto models = differential_linkage_models();
+        for (size_t p = 0; p < N_PARALLEL_PAIRS; p++) install(p, models[p]);
+        for (size_t p = N_PARALLEL_PAIRS; p < PAIR_LANES; p++) set_lane(p, LinkageModel());
+    }
+
+    // Known models for every pair (calibrated)
+    explicit KinematicTransform(const std::array<LinkageModel, N_PARALLEL_PAIRS> &models) : KinematicTransform() {
+        for (size_t p = 0; p < N_PARALLEL_PAIRS; p++) set_model(p, models[p]);
+    }
+
+    void set_model(size_t pair, const LinkageModel &model) {
+        if (pair >= N_PARALLEL_PAIRS) return;
+        install(pair, model);
+        calibrated_[pair] = true;
+    }
+
+    const LinkageModel &model(size_t pair) const { return models_[pair]; }
+
+    // Whether the pair's model came from set_model() rather than the placeholder
+    bool calibrated(size_t pair) const { return pair < N_PARALLEL_PAIRS && calibrated_[pair]; }
+
+    // Whether every pair is calibrated (required by joint_to_motor() and convert())
+    bool calibrated() const {
+        for (size_t p = 0; p < N_PARALLEL_PAIRS; p++) {
+            if (!calibrated_[p]) return false;
+        }
+        return true;
+    }
+
+    // Newton steps for joint_to_motor() (2-3 reach float precision for smooth linkages)
+    void set_newton_iterations(int n) { newton_iterations_ = n > 0 ? n : 1; }
+
+    // N_JOINTS arrays in motor space -> joint space; dq/tau pointers may be nullptr (both in and out)
+    void motor_to_joint(const float *q_m, const float *dq_m, const float *tau_m, float *q_j, float *dq_j, float *tau_j) const {
+        transform(false, q_m, dq_m, tau_m, q_j, dq_j, tau_j);
+    }
+
+    // N_JOINTS arrays in joint space -> motor space; dq/tau pointers may be nullptr (both in and out).
+    // Returns false and leaves the outputs untouched if a pair is uncalibrated.
+    bool joint_to_motor(const float *q_j, const float *dq_j, const float *tau_j, float *q_m, float *dq_m, float *tau_m) const {
+        if (!check_calibrated()) return false;
+        transform(true, q_j, dq_j, tau_j, q_m, dq_m, tau_m);
+        return true;
+    }
+
+    // Jacobian of every pair at the motor positions q_m (N_JOINTS array)
+    void jacobians(const float *q_m, PairJacobian *out) const;
+
+    // Joint-space q/dq/tau computed from the motor readings of a LowState
+    void joint_state_from_motors(const LowState &state, JointArray &q, JointArray &dq, JointArray &tau) const {
+        JointArray qm, dqm, taum;
+        for (size_t i = 0; i < N_JOINTS; i++) {
+            const MotorState &m = state.motor_state()[i];
+            qm[i]               = m.q();
+            dqm[i]              = m.dq();
+            taum[i]             = m.tau_est();
+        }
+        motor_to_joint(qm.data(), dqm.data(), taum.data(), q.data(), dq.data(), tau.data());
+    }
+
+    // Convert q/dq/tau of cmd to `mode` in place and set its kinematic_mode (no-op if already there).
+    // kp/kd of the parallel pairs map to the diagonal of J^T K J (the coupling terms are dropped).
+    // Returns false and leaves cmd untouched if a pair is uncalibrated.
+    bool convert(LowCmd &cmd, KinematicMode mode) const;
+
+  private:
+    // Pair lanes, padded to a whole number of SIMD vectors
+    static constexpr size_t PAIR_LANES = 8;
+
+    enum Coef { C0, C1, A00, A01, A10, A11, B00, B01, B02, B10, B11, B12, N_COEF };
+
+    void install(size_t p, const LinkageModel &m) {
+        models_[p] = m;
+        set_lane(p, m);
+    }
+
+    bool check_calibrated() const {
+        if (calibrated()) return true;
+        std::cerr << "[KinematicTransform] Linkage models not calibrated. Call set_model() or LinkageCalibrator::fit() first." << std::endl;
+        return false;
+    }
+
+    void set_lane(size_t p, const LinkageModel &m) {
+        const float v[N_COEF] = {m.c[0],    m.c[1],    m.a[0][0], m.a[0][1], m.a[1][0], m.a[1][1],
+                                 m.b[0][0], m.b[0][1], m.b[0][2], m.b[1][0], m.b[1][1], m.b[1][2]};
+        for (int k = 0; k < N_COEF; k++) coef_[k][p] = v[k];
+    }
+
+    // Pair data in SoA form: x = positions, v = velocities, t = torques (in/out)
+    struct PairBuffers {
+        alignas(32) float x0[PAIR_LANES] = {}, x1[PAIR_LANES] = {};
+        alignas(32) float v0[PAIR_LANES] = {}, v1[PAIR_LANES] = {};
+        alignas(32) float t0[PAIR_LANES] = {}, t1[PAIR_LANES] = {};
+        alignas(32) float j00[PAIR_LANES], j01[PAIR_LANES], j10[PAIR_LANES], j11[PAIR_LANES];
+    };
+
+    void transform(bool to_motor, const float *q, const float *dq, const float *tau, float *q_out, float *dq_out, float *tau_out) const;
+    template <typename S> void pair_kernel(bool to_motor, PairBuffers &b) const;
+
+    LinkageModel models_[N_PARALLEL_PAIRS];
+    bool calibrated_[N_PARALLEL_PAIRS] = {};
+    int newton_iterations_ = 3;
+    alignas(32) float coef_[N_COEF][PAIR_LANES];
+};
+
+template <typename S> inline void KinematicTransform::pair_kernel(bool to_motor, PairBuffers &b) const {
+    using F = typename S::F;
+    for (size_t i = 0; i < PAIR_LANES; i += S::W) {
+        F m0, m1;
+        if (to_motor) {
+            // Seed with the inverse of the linear part, then Newton on f(m) = q
+            F q0 = S::load(b.x0 + i), q1 = S::load(b.x1 + i);
+            F a00 = S::load(coef_[A00] + i), a01 = S::load(coef_[A01] + i);
+            F a10 = S::load(coef_[A10] + i), a11 = S::load(coef_[A11] + i);
+            F r0  = S::sub(q0, S::load(coef_[C0] + i));
+            F r1  = S::sub(q1, S::load(coef_[C1] + i));
+            F det = S::sub(S::mul(a00, a11), S::mul(a01, a10));
+            m0    = S::div(S::sub(S::mul(a11, r0), S::mul(a01, r1)), det);
+            m1    = S::div(S::sub(S::mul(a00, r1), S::mul(a10, r0)), det);
+            for (int it = 0; it < newton_iterations_; it++) {
+                detail::LinkageEval<S> e(coef_, i, m0, m1);
+                F e0 = S::sub(e.f0, q0), e1 = S::sub(e.f1, q1);
+                F d  = S::sub(S::mul(e.j00, e.j11), S::mul(e.j01, e.j10));
+                m0   = S::sub(m0, S::div(S::sub(S::mul(e.j11, e0), S::mul(e.j01, e1)), d));
+                m1   = S::sub(m1, S::div(S::sub(S::mul(e.j00, e1), S::mul(e.j10, e0)), d));
+            }
+            S::store(b.x0 + i, m0);
+            S::store(b.x1 + i, m1);
+        } else {
+            m0 = S::load(b.x0 + i);
+            m1 = S::load(b.x1 + i);
+        }
+
+        detail::LinkageEval<S> e(coef_, i, m0, m1);
+        F v0 = S::load(b.v0 + i), v1 = S::load(b.v1 + i);
+        F t0 = S::load(b.t0 + i), t1 = S::load(b.t1 + i);
+        if (to_motor) {
+            // dq_m = J^-1 dq_j, tau_m = J^T tau_j
+            F d = S::sub(S::mul(e.j00, e.j11), S::mul(e.j01, e.j10));
+            S::store(b.v0 + i, S::div(S::sub(S::mul(e.j11, v0), S::mul(e.j01, v1)), d));
+            S::store(b.v1 + i, S::div(S::sub(S::mul(e.j00, v1), S::mul(e.j10, v0)), d));
+            S::store(b.t0 + i, S::add(S::mul(e.j00, t0), S::mul(e.j10, t1)));
+            S::store(b.t1 + i, S::add(S::mul(e.j01, t0), S::mul(e.j11, t1)));
+        } else {
+            // dq_j = J dq_m, tau_j = J^-T tau_m
+            F d = S::sub(S::mul(e.j00, e.j11), S::mul(e.j01, e.j10));
+            S::store(b.x0 + i, e.f0);
+            S::store(b.x1 + i, e.f1);
+            S::store(b.v0 + i, S::add(S::mul(e.j00, v0), S::mul(e.j01, v1)));
+            S::store(b.v1 + i, S::add(S::mul(e.j10, v0), S::mul(e.j11, v1)));
+            S::store(b.t0 + i, S::div(S::sub(S::mul(e.j11, t0), S::mul(e.j10, t1)), d));
+            S::store(b.t1 + i, S::div(S::sub(S::mul(e.j00, t1), S::mul(e.j01, t0)), d));
+        }
+        S::store(b.j00 + i, e.j00);
+        S::store(b.j01 + i, e.j01);
+        S::store(b.j10 + i, e.j10);
+        S::store(b.j11 + i, e.j11);
+    }
+}
+
+inline void KinematicTransform::transform(bool to_motor, const float *q, const float *dq, const float *tau, float *q_out, float *dq_out,
+                                          float *tau_out) const {
+    for (size_t i = 0; i < N_JOINTS; i++) {
+        q_out[i] = q[i];
+        if (dq && dq_out) dq_out[i] = dq[i];
+        if (tau && tau_out) tau_out[i] = tau[i];
+    }
+
+    PairBuffers b;
+    for (size_t p = 0; p < N_PARALLEL_PAIRS; p++) {
+        const auto &idx = PARALLEL_PAIRS[p];
+        b.x0[p]         = q[idx[0]];
+        b.x1[p]         = q[idx[1]];
+        if (dq) {
+            b.v0[p] = dq[idx[0]];
+            b.v1[p] = dq[idx[1]];
+        }
+        if (tau) {
+            b.t0[p] = tau[idx[0]];
+            b.t1[p] = tau[idx[1]];
+        }
+    }
+
+    pair_kernel<detail::JointVec>(to_motor, b);
+
+    for (size_t p = 0; p < N_PARALLEL_PAIRS; p++) {
+        const auto &idx = PARALLEL_PAIRS[p];
+        q_out[idx[0]]   = b.x0[p];
+        q_out[idx[1]]   = b.x1[p];
+        if (dq && dq_out) {
+            dq_out[idx[0]] = b.v0[p];
+            dq_out[idx[1]] = b.v1[p];
+        }
+        if (tau && tau_out) {
+            tau_out[idx[0]] = b.t0[p];
+            tau_out[idx[1]] = b.t1[p];
+        }
+    }
+}
+
+inline void KinematicTransform::jacobians(const float *q_m, PairJacobian *out) const {
+    PairBuffers b;
+    for (size_t p = 0; p < N_PARALLEL_PAIRS; p++) {
+        b.x0[p] = q_m[PARALLEL_PAIRS[p][0]];
+        b.x1[p] = q_m[PARALLEL_PAIRS[p][1]];
+    }
+    pair_kernel<detail::JointVec>(false, b);
+    for (size_t p = 0; p < N_PARALLEL_PAIRS; p++) {
+        out[p] = {{{b.j00[p], b.j01[p]}, {b.j10[p], b.j11[p]}}};
+    }
+}
+
+inline bool KinematicTransform::convert(LowCmd &cmd, KinematicMode mode) const {
+    if (cmd.kinematic_mode() == mode) return true;
+    if (!check_calibrated()) return false;
+    const bool to_motor = mode == KinematicMode::MS;
+
+    auto &motors = cmd.motors();
+    JointArray q, dq, tau, q_out, dq_out, tau_out;
+    for (size_t i = 0; i < N_JOINTS; i++) {
+        q[i]   = motors[i].q();
+        dq[i]  = motors[i].dq();
+        tau[i] = motors[i].tau();
+    }
+    transform(to_motor, q.data(), dq.data(), tau.data(), q_out.data(), dq_out.data(), tau_out.data());
+
+    // Jacobian at the motor-space position of the command
+    PairJacobian jac[N_PARALLEL_PAIRS];
+    jacobians(to_motor ? q_out.data() : q.data(), jac);
+
+    for (size_t p = 0; p < N_PARALLEL_PAIRS; p++) {
+        const auto &idx = PARALLEL_PAIRS[p];
+        const auto &j   = jac[p].j;
+        float kp[2]     = {motors[idx[0]].kp(), motors[idx[1]].kp()};
+        float kd[2]     = {motors[idx[0]].kd(), motors[idx[1]].kd()};
+        for (int i = 0; i < 2; i++) {
+            float kp_out, kd_out;
+            if (to_motor) {
+                // K_m,ii = sum_k J_ki^2 K_j,kk
+                kp_out = j[0][i] * j[0][i] * kp[0] + j[1][i] * j[1][i] * kp[1];
+                kd_out = j[0][i] * j[0][i] * kd[0] + j[1][i] * j[1][i] * kd[1];
+            } else {
+                // K_j,kk = sum_i (J^-1)_ik^2 K_m,ii
+                float d     = j[0][0] * j[1][1] - j[0][1] * j[1][0];
+                float inv0k = (i == 0 ? j[1][1] : -j[0][1]) / d;
+                float inv1k = (i == 0 ? -j[1][0] : j[0][0]) / d;
+                kp_out      = inv0k * inv0k * kp[0] + inv1k * inv1k * kp[1];
+                kd_out      = inv0k * inv0k * kd[0] + inv1k * inv1k * kd[1];
+            }
+            motors[idx[i]].kp(kp_out);
+            motors[idx[i]].kd(kd_out);
+        }
+    }
+
+    for (size_t i = 0; i < N_JOINTS; i++) {
+        motors[i].q(q_out[i]);
+        motors[i].dq(dq_out[i]);
+        motors[i].tau(tau_out[i]);
+    }
+    cmd.kinematic_mode(mode);
+    return true;
+}
+
+/**
+ * @brief Fits LinkageModel coefficients from LowState samples
+ *
+ * LowState reports every parallel pair in both spaces (motor_state and joint_state),
+ * so sweeping the mechanisms through their range once is enough to identify the map.
+ * Quadratic terms are lightly regularized so that a sweep along one axis still
+ * yields a usable (linear) model.
+ */
+class LinkageCalibrator {
+  public:
+    void add_sample(const LowState &state) {
+        for (size_t p = 0; p < N_PARALLEL_PAIRS; p++) {
+            const auto &idx = PARALLEL_PAIRS[p];
+            double m0       = state.motor_state()[idx[0]].q();
+            double m1       = state.motor_state()[idx[1]].q();
+            double y[2]     = {state.joint_state()[idx[0]].q(), state.joint_state()[idx[1]].q()};
+            double x[6]     = {1.0, m0, m1, m0 * m0, m0 * m1, m1 * m1};
+            for (int r = 0; r < 6; r++) {
+                for (int c = 0; c < 6; c++) xtx_[p][r][c] += x[r] * x[c];
+                for (int k = 0; k < 2; k++) xty_[p][k][r] += x[r] * y[k];
+            }
+            for (int k = 0; k < 2; k++) yy_[p][k] += y[k] * y[k];
+        }
+        samples_++;
+    }
+
+    size_t samples() const { return samples_; }
+
+    // Fit all pairs into kin; returns the worst RMS position residual (rad), or -1 with kin unchanged
+    // if there are too few samples or a pair is degenerate
+    double fit(KinematicTransform &kin, bool quadratic = true) const {
+        const int n = quadratic ? 6 : 3;
+        if (samples_ < static_cast<size_t>(2 * n)) return -1.0;
+
+        // Solve every pair before installing any, so a failure leaves kin untouched
+        double worst = 0.0;
+        LinkageModel models[N_PARALLEL_PAIRS];
+        for (size_t p = 0; p < N_PARALLEL_PAIRS; p++) {
+            LinkageModel &model = models[p];
+            for (int k = 0; k < 2; k++) {
+                double A[6][7];
+                for (int r = 0; r < n; r++) {
+                    for (int c = 0; c < n; c++) A[r][c] = xtx_[p][r][c];
+                    A[r][n] = xty_[p][k][r];
+                    if (r >= 3) A[r][r] += 1e-6 * static_cast<double>(samples_);
+                }
+                double beta[6] = {};
+                if (!solve(A, n, beta)) return -1.0;
+
+                // SSR = y'y - 2 b'X'y + b'X'X b
+                double ssr = yy_[p][k];
+                for (int r = 0; r < n; r++) {
+                    ssr -= 2.0 * beta[r] * xty_[p][k][r];
+                    for (int c = 0; c < n; c++) ssr += beta[r] * xtx_[p][r][c] * beta[c];
+                }
+                worst = std::max(worst, std::sqrt(std::max(0.0, ssr) / static_cast<double>(samples_)));
+
+                model.c[k]    = static_cast<float>(beta[0]);
+                model.a[k][0] = static_cast<float>(beta[1]);
+                model.a[k][1] = static_cast<float>(beta[2]);
+                for (int q = 0; q < 3; q++) model.b[k][q] = static_cast<float>(beta[3 + q]);
+            }
+        }
+        for (size_t p = 0; p < N_PARALLEL_PAIRS; p++) {
+            kin.set_model(p, models[p]);
+        }
+        return worst;
+    }
+
+    void reset() { *this = LinkageCalibrator(); }
+
+  private:
+    // Gaussian elimination with partial pivoting on the augmented n x (n+1) system
+    static bool solve(double (&A)[6][7], int n, double *x) {
+        for (int col = 0; col < n; col++) {
+            int piv = col;
+            for (int r = col + 1; r < n; r++) {
+                if (std::fabs(A[r][col]) > std::fabs(A[piv][col])) piv = r;
+            }
+            if (std::fabs(A[piv][col]) < 1e-12) return false;
+            for (int c = 0; c <= n; c++) std::swap(A[col][c], A[piv][c]);
+            for (int r = col + 1; r < n; r++) {
+                double f = A[r][col] / A[col][col];
+                for (int c = col; c <= n; c++) A[r][c] -= f * A[col][c];
+            }
+        }
+        for (int r = n - 1; r >= 0; r--) {
+            double s = A[r][n];
+            for (int c = r + 1; c < n; c++) s -= A[r][c] * x[c];
+            x[r] = s / A[r][r];
+        }
+        return true;
+    }
+
+    size_t samples_ = 0;
+    double xtx_[N_PARALLEL_PAIRS][6][6]{};
+    double xty_[N_PARALLEL_PAIRS][2][6]{};
+    double yy_[N_PARALLEL_PAIRS][2]{};
+};
+
+}  // namespace igris_sdk
@@ -0,0 +1,68 @@
+#pragma once
+
+#include "igris_sdk/publisher.hpp"
+#include "igris_sdk/types.hpp"
+
+#include <cstdint>
+
+namespace igris_sdk {
+
+// Fill all 31 motors of cmd from contiguous per-joint arrays (LowCmd index order).
+// A null array leaves that field unchanged, e.g. to set kp/kd once and stream q only.
+inline void fill_low_cmd(LowCmd &cmd, const float *q, const float *dq, const float *tau, const float *kp, const float *kd,
+                         KinematicMode mode) {
+    cmd.kinematic_mode(mode);
+    auto &motors = cmd.motors();
+    for (size_t i = 0; i < N_JOINTS; i++) {
+        MotorCmd &m = motors[i];
+        m.id(static_cast<uint16_t>(i));
+        if (q) m.q(q[i]);
+        if (dq) m.dq(dq[i]);
+        if (tau) m.tau(tau[i]);
+        if (kp) m.kp(kp[i]);
+        if (kd) m.kd(kd[i]);
+    }
+}
+
+/**
+ * @brief Publishes LowCmd from contiguous float arrays through a preallocated message
+ *
+ * Replaces the 31 x 6 setter calls per cycle of building a LowCmd field by field
+ * with one call taking five float[31] arrays. This is the entry point for
+ * language bindings: a Python binding passes NumPy float32 buffers and releases
+ * the interpreter lock around write().
+ *
+ * Not thread-safe; use one writer per control thread.
+ *
+ * Example:
+ * @code
+ * LowCmdArrayWriter writer(publisher);
+ * writer.write(q, dq, tau, kp, kd, KinematicMode::PJS);  // float[31] each
+ * @endcode
+ */
+class LowCmdArrayWriter {
+  public:
+    explicit LowCmdArrayWriter(Publisher<LowCmd> &publisher) : publisher_(publisher) {}
+
+    // Fill the preallocated command and publish it; null arrays keep the previous values
+    bool write(const float *q, const float *dq, const float *tau, const float *kp, const float *kd, KinematicMode mode) {
+        fill_low_cmd(cmd_, q, dq, tau, kp, kd, mode);
+        return publisher_.write(cmd_);
+    }
+
+    // Same as write(), with a filter stage (e.g. CommandFilter) before publishing
+    template <typename Filter>
+    bool write(const float *q, const float *dq, const float *tau, const float *kp, const float *kd, KinematicMode mode, Filter &filter) {
+        fill_low_cmd(cmd_, q, dq, tau, kp, kd, mode);
+        return publisher_.write(cmd_, filter);
+    }
+
+    // Last command written (after filtering)
+    const LowCmd &cmd() const { return cmd_; }
+
+  private:
+    Publisher<LowCmd> &publisher_;
+    LowCmd cmd_;
+};
+
+}  // namespace igris_sdk
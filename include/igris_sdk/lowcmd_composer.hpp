@@ -0,0 +1,301 @@
+#pragma once
+
+#include "igris_sdk/types.hpp"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <string>
+
+namespace igris_sdk {
+
+enum class StaleAction {
+    Hold,     // Keep sending the limb's last command
+    Damping,  // Last q and kd with kp = 0, dq = 0, tau = 0
+};
+
+/**
+ * @brief State of one limb as seen by the last compose()
+ */
+struct LimbStatus {
+    uint64_t writes       = 0;     // Commands written by the limb's producer
+    uint64_t stale_ticks  = 0;     // compose() calls that found the limb stale
+    uint64_t stale_events = 0;     // Times the limb went from fresh to stale
+    int64_t age_us        = -1;    // Age of the command used by the last compose() (-1: never written)
+    bool stale            = true;  // Stale at the last compose()
+};
+
+namespace detail {
+
+// Command of one limb, indexed by LowCmd motor index. Written by one producer under
+// a seqlock (seq is odd while a write is in progress); the fields are relaxed atomics
+// so the reader's speculative copy is not a data race.
+struct LimbSlot {
+    alignas(64) std::atomic<uint32_t> seq{0};
+    std::atomic<int64_t> stamp_ns{0};
+    std::atomic<float> q[N_JOINTS];
+    std::atomic<float> dq[N_JOINTS];
+    std::atomic<float> tau[N_JOINTS];
+    std::atomic<float> kp[N_JOINTS];
+    std::atomic<float> kd[N_JOINTS];
+};
+
+// Last consistent copy of a LimbSlot (publisher thread only)
+struct LimbSnapshot {
+    uint32_t seq     = 0;
+    int64_t stamp_ns = 0;
+    float q[N_JOINTS]{};
+    float dq[N_JOINTS]{};
+    float tau[N_JOINTS]{};
+    float kp[N_JOINTS]{};
+    float kd[N_JOINTS]{};
+};
+
+}  // namespace detail
+
+/**
+ * @brief Lock-free LowCmd assembly from per-limb controller threads
+ *
+ * Each limb owns a contiguous range of LowCmd motor indices and is written by
+ * exactly one producer thread (e.g. the leg, arm and neck controllers), which
+ * never blocks: write() stores the limb's fields under a per-limb seqlock. The
+ * publisher thread calls compose() once per tick to copy every limb into the
+ * command; a limb whose write is in progress is retried a few times, and if it
+ * stays busy its previous consistent copy is used, so a preempted producer
+ * cannot stall the publisher. Each limb's command is always internally
+ * consistent (never half of one write and half of the next).
+ *
+ * A limb is stale when its producer has not written for timeout_us. compose()
+ * then applies the limb's StaleAction and reports it in the returned mask. Until
+ * the first write a limb is stale and sends q = kp = kd = 0 (no torque), so wait
+ * for compose() to return 0 before the first publish.
+ *
+ * add_limb() is setup and not thread-safe; call it before the threads start.
+ * Motors outside all limbs keep whatever the caller put in cmd.
+ *
+ * Example:
+ * @code
+ * LowCmdComposer composer(KinematicMode::MS);
+ * int waist = composer.add_limb("waist", MotorIndex::WAIST_YAW, 3);                                // 0-2
+ * int legs  = composer.add_limb("legs", MotorIndex::L_HIP_PITCH, 12, 5000, StaleAction::Damping);  // 3-14
+ * int arms  = composer.add_limb("arms", MotorIndex::L_SHOULDER_PITCH, 14);                         // 15-28
+ *
+ * // Arm controller thread: arrays indexed within the limb (14 entries)
+ * composer.write(arms, q, dq, tau, kp, kd);
+ *
+ * // Publisher thread, every tick
+ * publisher.write(cmd, composer);  // compose(cmd), then publish
+ * @endcode
+ */
+class LowCmdComposer {
+  public:
+    static constexpr size_t MAX_LIMBS         = 8;
+    static constexpr int MAX_READ_ATTEMPTS    = 16;  // Seqlock retries per limb before using the previous copy
+    static constexpr uint32_t DEFAULT_TIMEOUT = 10000;
+
+    static_assert(std::atomic<float>::is_always_lock_free, "LowCmdComposer needs lock-free float atomics");
+
+    explicit LowCmdComposer(KinematicMode mode = KinematicMode::PJS) : mode_(mode) {}
+
+    LowCmdComposer(const LowCmdComposer &)            = delete;
+    LowCmdComposer &operator=(const LowCmdComposer &) = delete;
+
+    // Register motors [first, first + count) as one limb; returns its id, or -1 on an invalid or overlapping range
+    int add_limb(const std::string &name, uint32_t first, uint32_t count, uint32_t timeout_us = DEFAULT_TIMEOUT,
+                 StaleAction action = StaleAction::Hold) {
+        if (n_limbs_ >= MAX_LIMBS) {
+            std::cerr << "[LowCmdComposer] Too many limbs (max " << MAX_LIMBS << ")" << std::endl;
+            return -1;
+        }
+        if (count == 0 || first >= N_JOINTS || count > N_JOINTS - first) {
+            std::cerr << "[LowCmdComposer] Invalid range for " << name << ": [" << first << ", " << first + count << ")" << std::endl;
+            return -1;
+        }
+        const uint32_t mask = static_cast<uint32_t>(((uint64_t(1) << count) - 1) << first);
+        if (owned_ & mask) {
+            std::cerr << "[LowCmdComposer] " << name << " overlaps another limb" << std::endl;
+            return -1;
+        }
+        owned_ |= mask;
+
+        Limb &limb      = limbs_[n_limbs_];
+        limb.name       = name;
+        limb.first      = first;
+        limb.count      = count;
+        limb.timeout_ns = static_cast<int64_t>(timeout_us) * 1000;
+        limb.action     = action;
+        for (size_t i = 0; i < N_JOINTS; i++) {
+            limb.slot.q[i].store(0.0f, std::memory_order_relaxed);
+            limb.slot.dq[i].store(0.0f, std::memory_order_relaxed);
+            limb.slot.tau[i].store(0.0f, std::memory_order_relaxed);
+            limb.slot.kp[i].store(0.0f, std::memory_order_relaxed);
+            limb.slot.kd[i].store(0.0f, std::memory_order_relaxed);
+        }
+        return static_cast<int>(n_limbs_++);
+    }
+
+    // ========== Producer (one thread per limb) ==========
+
+    // Write a limb's command; arrays hold count entries (limb-local index). A null array
+    // keeps the limb's previous values; all null only refreshes the limb's timestamp.
+    bool write(int limb, const float *q, const float *dq, const float *tau, const float *kp, const float *kd) {
+        if (limb < 0 || static_cast<size_t>(limb) >= n_limbs_) return false;
+        Limb &l                = limbs_[limb];
+        detail::LimbSlot &slot = l.slot;
+
+        const uint32_t seq = slot.seq.load(std::memory_order_relaxed);
+        slot.seq.store(seq + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        for (uint32_t i = 0; i < l.count; i++) {
+            const uint32_t j = l.first + i;
+            if (q) slot.q[j].store(q[i], std::memory_order_relaxed);
+            if (dq) slot.dq[j].store(dq[i], std::memory_order_relaxed);
+            if (tau) slot.tau[j].store(tau[i], std::memory_order_relaxed);
+            if (kp) slot.kp[j].store(kp[i], std::memory_order_relaxed);
+            if (kd) slot.kd[j].store(kd[i], std::memory_order_relaxed);
+        }
+        slot.stamp_ns.store(now_ns(), std::memory_order_relaxed);
+        slot.seq.store(seq + 2, std::memory_order_release);
+        return true;
+    }
+
+    // ========== Publisher thread ==========
+
+    // Copy every limb into cmd; returns a mask of stale limbs (bit = limb id)
+    uint32_t compose(LowCmd &cmd) {
+        const int64_t now = now_ns();
+        uint32_t stale    = 0;
+        cmd.kinematic_mode(mode_.load(std::memory_order_relaxed));
+        auto &motors = cmd.motors();
+
+        for (size_t id = 0; id < n_limbs_; id++) {
+            Limb &limb = limbs_[id];
+            int64_t stamp_ns;
+            if (read(limb)) {
+                stamp_ns = limb.snapshots[limb.current].stamp_ns;
+            } else {
+                // The producer is mid-write: it is alive, but its command is still the previous copy
+                contended_.fetch_add(1, std::memory_order_relaxed);
+                stamp_ns = limb.slot.stamp_ns.load(std::memory_order_relaxed);
+            }
+            const detail::LimbSnapshot &s = limb.snapshots[limb.current];
+
+            const bool written   = limb.slot.seq.load(std::memory_order_relaxed) != 0;
+            const int64_t age    = written ? std::max<int64_t>(0, now - stamp_ns) : -1;
+            const bool is_stale  = !written || age > limb.timeout_ns;
+            const bool was_stale = limb.stale.exchange(is_stale, std::memory_order_relaxed);
+            limb.age_us.store(written ? age / 1000 : -1, std::memory_order_relaxed);
+            if (is_stale) {
+                stale |= 1u << id;
+                limb.stale_ticks.fetch_add(1, std::memory_order_relaxed);
+                if (!was_stale) limb.stale_events.fetch_add(1, std::memory_order_relaxed);
+            }
+
+            const bool damping = is_stale && limb.action == StaleAction::Damping;
+            for (uint32_t j = limb.first; j < limb.first + limb.count; j++) {
+                MotorCmd &m = motors[j];
+                m.id(static_cast<uint16_t>(j));
+                m.q(s.q[j]);
+                m.dq(damping ? 0.0f : s.dq[j]);
+                m.tau(damping ? 0.0f : s.tau[j]);
+                m.kp(damping ? 0.0f : s.kp[j]);
+                m.kd(s.kd[j]);
+            }
+        }
+        composed_.fetch_add(1, std::memory_order_relaxed);
+        return stale;
+    }
+
+    // Compose into cmd (use as publisher.write(cmd, composer)); never rejects
+    bool apply(LowCmd &cmd) {
+        compose(cmd);
+        return true;
+    }
+
+    // ========== Any thread ==========
+
+    void set_mode(KinematicMode mode) { mode_.store(mode, std::memory_order_relaxed); }
+
+    size_t limb_count() const { return n_limbs_; }
+    const std::string &limb_name(int limb) const { return limbs_[limb].name; }
+
+    LimbStatus limb_status(int limb) const {
+        const Limb &l = limbs_[limb];
+        LimbStatus s;
+        s.writes       = l.slot.seq.load(std::memory_order_relaxed) / 2;
+        s.stale_ticks  = l.stale_ticks.load(std::memory_order_relaxed);
+        s.stale_events = l.stale_events.load(std::memory_order_relaxed);
+        s.age_us       = l.age_us.load(std::memory_order_relaxed);
+        s.stale        = l.stale.load(std::memory_order_relaxed);
+        return s;
+    }
+
+    // compose() calls so far
+    uint64_t composed() const { return composed_.load(std::memory_order_relaxed); }
+
+    // Limb reads that gave up on a busy producer and reused the previous copy
+    uint64_t contended() const { return contended_.load(std::memory_order_relaxed); }
+
+  private:
+    struct Limb {
+        std::string name;
+        uint32_t first     = 0;
+        uint32_t count     = 0;
+        int64_t timeout_ns = 0;
+        StaleAction action = StaleAction::Hold;
+
+        detail::LimbSlot slot;
+        detail::LimbSnapshot snapshots[2];  // Current and the one being read into
+        int current = 0;
+
+        std::atomic<bool> stale{true};
+        std::atomic<int64_t> age_us{-1};
+        std::atomic<uint64_t> stale_ticks{0};
+        std::atomic<uint64_t> stale_events{0};
+    };
+
+    static int64_t now_ns() {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+
+    // Seqlock read of limb.slot into the inactive snapshot, which becomes current on success;
+    // false if the producer stayed busy (the current snapshot is kept)
+    bool read(Limb &limb) {
+        const detail::LimbSlot &slot = limb.slot;
+        detail::LimbSnapshot &next   = limb.snapshots[limb.current ^ 1];
+        for (int attempt = 0; attempt < MAX_READ_ATTEMPTS; attempt++) {
+            const uint32_t seq = slot.seq.load(std::memory_order_acquire);
+            if (seq & 1u) continue;
+            if (seq == limb.snapshots[limb.current].seq) return true;  // Unchanged since the last tick
+
+            next.stamp_ns = slot.stamp_ns.load(std::memory_order_relaxed);
+            for (uint32_t j = limb.first; j < limb.first + limb.count; j++) {
+                next.q[j]   = slot.q[j].load(std::memory_order_relaxed);
+                next.dq[j]  = slot.dq[j].load(std::memory_order_relaxed);
+                next.tau[j] = slot.tau[j].load(std::memory_order_relaxed);
+                next.kp[j]  = slot.kp[j].load(std::memory_order_relaxed);
+                next.kd[j]  = slot.kd[j].load(std::memory_order_relaxed);
+            }
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (slot.seq.load(std::memory_order_relaxed) != seq) continue;
+
+            next.seq = seq;
+            limb.current ^= 1;
+            return true;
+        }
+        return false;
+    }
+
+    std::atomic<KinematicMode> mode_;
+    std::array<Limb, MAX_LIMBS> limbs_;
+    size_t n_limbs_ = 0;
+    uint32_t owned_ = 0;
+
+    std::atomic<uint64_t> composed_{0};
+    std::atomic<uint64_t> contended_{0};
+};
+
+}  // namespace igris_sdk
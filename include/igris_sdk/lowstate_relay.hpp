@@ -0,0 +1,213 @@
+#pragma once
+
+#include "igris_sdk/channel_factory.hpp"
+#include "igris_sdk/lowstate_window.hpp"
+#include "igris_sdk/publisher.hpp"
+#include "igris_sdk/subscriber.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+
+namespace igris_sdk {
+
+/**
+ * @brief Configuration for LowStateRelay
+ */
+struct LowStateRelayConfig {
+    std::string input_topic  = "rt/lowstate";
+    std::string output_topic = "rt/lowstate_relay";  // Window mean; min/max on output_topic + "/min" and "/max"
+    double rate_hz           = 10.0;                 // Output rate (windows per second)
+    bool publish_min_max     = false;                // Also publish the window min/max
+    float quantum            = 0.0f;                 // > 0: round float fields to multiples of quantum
+    bool skip_unchanged      = false;                // Drop windows whose mean equals the last published one...
+    double keepalive_s       = 1.0;                  // ...but publish at least this often
+};
+
+/**
+ * @brief Decimating LowState republisher for dashboards and remote viewers
+ *
+ * Subscribes to LowState once at full rate and republishes one LowState per
+ * window (1 / rate_hz) on a separate topic, optionally on another domain: the
+ * window mean on output_topic, and with publish_min_max the window min/max on
+ * output_topic + "/min" and "/max" (see LowStateWindow for how fields are
+ * aggregated). Remote tools subscribe to the relay topic, so the robot-side
+ * fan-out of rt/lowstate stays fixed however many viewers connect, and the
+ * wireless link carries rate_hz instead of the full-rate stream.
+ *
+ * Quantizing does not shrink a sample (floats stay floats on the wire), but with
+ * skip_unchanged it lets a robot standing still stop producing traffic apart
+ * from one keepalive sample per keepalive_s.
+ *
+ * Example:
+ * @code
+ * ChannelFactory robot;   robot.Init(0);   // robot network
+ * ChannelFactory remote;  remote.Init(1);  // Wi-Fi side
+ * LowStateRelayConfig config;
+ * config.rate_hz         = 20.0;
+ * config.publish_min_max = true;
+ * LowStateRelay relay(config);
+ * relay.start(robot, remote);  // viewers subscribe to "rt/lowstate_relay" on domain 1
+ * @endcode
+ */
+class LowStateRelay {
+  public:
+    struct Stats {
+        uint64_t received  = 0;  // Input samples
+        uint64_t published = 0;  // Output windows published
+        uint64_t skipped   = 0;  // Windows dropped by skip_unchanged
+    };
+
+    explicit LowStateRelay(const LowStateRelayConfig &config = LowStateRelayConfig()) : config_(config) {}
+    ~LowStateRelay() { stop(); }
+
+    LowStateRelay(const LowStateRelay &)            = delete;
+    LowStateRelay &operator=(const LowStateRelay &) = delete;
+
+    // Subscribe to input_topic on input and republish on output (the same factory, or another domain)
+    bool start(ChannelFactory &input, ChannelFactory &output) {
+        if (running_) return false;
+        subscriber_ = std::make_unique<Subscriber<LowState>>(config_.input_topic);
+        if (!subscriber_->init(input, [this](const LowState &state) { push(state); })) {
+            std::cerr << "[LowStateRelay] Failed to subscribe to " << config_.input_topic << std::endl;
+            subscriber_.reset();
+            return false;
+        }
+        if (!start(output)) {
+            subscriber_->stop();
+            subscriber_.reset();
+            return false;
+        }
+        return true;
+    }
+
+    // Republish only; feed samples with push(), e.g. from an existing LowState callback
+    bool start(ChannelFactory &output) {
+        if (running_) return false;
+        if (config_.rate_hz <= 0.0) {
+            std::cerr << "[LowStateRelay] rate_hz must be positive" << std::endl;
+            return false;
+        }
+        mean_pub_ = std::make_unique<Publisher<LowState>>(config_.output_topic);
+        bool ok   = mean_pub_->init(output);
+        if (ok && config_.publish_min_max) {
+            min_pub_ = std::make_unique<Publisher<LowState>>(config_.output_topic + "/min");
+            max_pub_ = std::make_unique<Publisher<LowState>>(config_.output_topic + "/max");
+            ok       = min_pub_->init(output) && max_pub_->init(output);
+        }
+        if (!ok) {
+            std::cerr << "[LowStateRelay] Failed to create publishers on " << config_.output_topic << std::endl;
+            mean_pub_.reset();
+            min_pub_.reset();
+            max_pub_.reset();
+            return false;
+        }
+
+        running_ = true;
+        thread_  = std::thread(&LowStateRelay::publishThread, this);
+        std::cout << "[LowStateRelay] " << config_.input_topic << " -> " << config_.output_topic << " at " << config_.rate_hz << "Hz"
+                  << std::endl;
+        return true;
+    }
+
+    // Add one input sample to the current window
+    void push(const LowState &state) {
+        std::lock_guard<std::mutex> lock(window_mutex_);
+        window_.push(state);
+        received_++;
+    }
+
+    void stop() {
+        if (subscriber_) {
+            subscriber_->stop();
+            subscriber_.reset();
+        }
+        {
+            std::lock_guard<std::mutex> lock(wake_mutex_);
+            running_ = false;
+        }
+        wake_.notify_all();
+        if (thread_.joinable()) thread_.join();
+    }
+
+    bool is_running() const { return running_; }
+
+    Stats stats() const {
+        Stats s;
+        s.received  = received_;
+        s.published = published_;
+        s.skipped   = skipped_;
+        return s;
+    }
+
+  private:
+    void publishThread() {
+        using Clock          = std::chrono::steady_clock;
+        const auto period    = std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(1.0 / config_.rate_hz));
+        const auto keepalive = std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(config_.keepalive_s));
+        LowState mean, min, max, last;
+        bool have_last      = false;
+        auto last_published = Clock::now();
+        auto next           = Clock::now() + period;
+
+        while (true) {
+            {
+                std::unique_lock<std::mutex> lock(wake_mutex_);
+                if (wake_.wait_until(lock, next, [this] { return !running_; })) break;
+            }
+            next += period;
+
+            bool ok;
+            {
+                std::lock_guard<std::mutex> lock(window_mutex_);
+                ok = window_.take(mean, config_.publish_min_max ? &min : nullptr, config_.publish_min_max ? &max : nullptr, config_.quantum);
+            }
+            if (!ok) continue;  // No input this window
+
+            const auto now = Clock::now();
+            if (config_.skip_unchanged && have_last && now - last_published < keepalive) {
+                last.tick(mean.tick());
+                if (last == mean) {
+                    skipped_++;
+                    continue;
+                }
+            }
+
+            mean_pub_->write(mean);
+            if (config_.publish_min_max) {
+                min_pub_->write(min);
+                max_pub_->write(max);
+            }
+            published_++;
+            last           = mean;
+            have_last      = true;
+            last_published = now;
+        }
+    }
+
+    LowStateRelayConfig config_;
+    std::unique_ptr<Subscriber<LowState>> subscriber_;
+    std::unique_ptr<Publisher<LowState>> mean_pub_;
+    std::unique_ptr<Publisher<LowState>> min_pub_;
+    std::unique_ptr<Publisher<LowState>> max_pub_;
+
+    std::mutex window_mutex_;
+    LowStateWindow window_;
+
+    std::mutex wake_mutex_;
+    std::condition_variable wake_;
+    std::atomic<bool> running_{false};
+    std::thread thread_;
+
+    std::atomic<uint64_t> received_{0};
+    std::atomic<uint64_t> published_{0};
+    std::atomic<uint64_t> skipped_{0};
+};
+
+}  // namespace igris_sdk
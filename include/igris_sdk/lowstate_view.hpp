@@ -0,0 +1,247 @@
+#pragma once
+
+#include "igris_sdk/igris_c_msgs.hpp"
+#include "igris_sdk/subscriber_impl.hpp"
+#include "igris_sdk/types.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+namespace igris_sdk {
+
+// Parts of LowState decoded by LowStateView (bitmask)
+enum LowStatePart : uint32_t {
+    LOWSTATE_TICK              = 1u << 0,
+    LOWSTATE_IMU               = 1u << 1,
+    LOWSTATE_MOTOR_Q           = 1u << 2,
+    LOWSTATE_MOTOR_DQ          = 1u << 3,
+    LOWSTATE_MOTOR_TAU         = 1u << 4,
+    LOWSTATE_MOTOR_TEMPERATURE = 1u << 5,
+    LOWSTATE_MOTOR_STATUS      = 1u << 6,
+    LOWSTATE_JOINT_Q           = 1u << 7,
+    LOWSTATE_JOINT_DQ          = 1u << 8,
+    LOWSTATE_JOINT_TAU         = 1u << 9,
+    LOWSTATE_JOINT_STATUS      = 1u << 10,
+
+    LOWSTATE_MOTOR = LOWSTATE_MOTOR_Q | LOWSTATE_MOTOR_DQ | LOWSTATE_MOTOR_TAU | LOWSTATE_MOTOR_TEMPERATURE | LOWSTATE_MOTOR_STATUS,
+    LOWSTATE_JOINT = LOWSTATE_JOINT_Q | LOWSTATE_JOINT_DQ | LOWSTATE_JOINT_TAU | LOWSTATE_JOINT_STATUS,
+    LOWSTATE_ALL   = LOWSTATE_TICK | LOWSTATE_IMU | LOWSTATE_MOTOR | LOWSTATE_JOINT,
+};
+
+namespace detail {
+
+// CDR offsets of LowState fields after the encapsulation header. LowState is a
+// final, fixed-size type without 8-byte members, so XCDR1 and XCDR2 lay it out
+// identically except for the DHEADER XCDR2 puts before each array of structs.
+struct LowStateCdr {
+    static constexpr size_t TICK         = 0;
+    static constexpr size_t IMU          = 4;   // quaternion[4], gyroscope[3], accelerometer[3], rpy[3]
+    static constexpr size_t MOTOR_STRIDE = 20;  // q, dq, tau_est, temperature (+2 padding), status_bits
+    static constexpr size_t JOINT_STRIDE = 16;  // q, dq, tau_est, status_bits
+
+    static constexpr size_t motors(size_t dheader) { return 56 + dheader; }
+    static constexpr size_t joints(size_t dheader) { return motors(dheader) + N_JOINTS * MOTOR_STRIDE + dheader; }
+};
+
+}  // namespace detail
+
+/**
+ * @brief LowState subscription that decodes only selected fields
+ *
+ * A Subscriber<LowState> deserializes the whole message (tick, IMU and 62
+ * motor/joint records) for every sample. LowStateView<Parts, First, Count> is a
+ * separate C++ type for the same DDS type: it matches the robot's LowState
+ * writer, but its deserializer reads only the fields in Parts, for motor/joint
+ * indices [First, First + Count), straight from their fixed offsets in the CDR
+ * buffer. Everything else in state() stays zero.
+ *
+ * Use it with Subscriber<> like any message type (the template definitions come
+ * with this header). Readers of LowState and of any views may coexist in one
+ * process; each decodes only what it needs.
+ *
+ * Example:
+ * @code
+ * // IMU monitor
+ * Subscriber<LowStateView<LOWSTATE_TICK | LOWSTATE_IMU>> imu_sub("rt/lowstate");
+ * imu_sub.init([](const auto &view) { use(view.state().imu_state()); });
+ *
+ * // Leg controller: joint q/dq of joints 0-11
+ * using LegState = LowStateView<LOWSTATE_JOINT_Q | LOWSTATE_JOINT_DQ, 0, 12>;
+ * Subscriber<LegState> leg_sub("rt/lowstate");
+ * @endcode
+ */
+template <uint32_t Parts, uint32_t First = 0, uint32_t Count = N_JOINTS> class LowStateView {
+  public:
+    static_assert((Parts & ~static_cast<uint32_t>(LOWSTATE_ALL)) == 0, "Unknown LowStatePart bits");
+    static_assert(First + Count <= N_JOINTS, "Motor/joint range exceeds N_JOINTS");
+
+    static constexpr uint32_t parts       = Parts;
+    static constexpr uint32_t first_joint = First;
+    static constexpr uint32_t joint_count = Count;
+
+    // Decoded fields; parts not selected are zero
+    const LowState &state() const { return state_; }
+    LowState &state() { return state_; }
+
+    bool operator==(const LowStateView &other) const { return state_ == other.state_; }
+    bool operator!=(const LowStateView &other) const { return !(*this == other); }
+
+  private:
+    LowState state_;
+};
+
+}  // namespace igris_sdk
+
+namespace org {
+namespace eclipse {
+namespace cyclonedds {
+namespace core {
+namespace cdr {
+
+template <typename S, uint32_t P, uint32_t F, uint32_t C, std::enable_if_t<std::is_base_of<cdr_stream, S>::value, bool> = true>
+bool read(S &str, ::igris_sdk::LowStateView<P, F, C> &instance, bool as_key) {
+    using Cdr = ::igris_sdk::detail::LowStateCdr;
+    str.set_mode(cdr_stream::stream_mode::read, as_key);
+    if (as_key) return true;  // Keyless
+
+    ::igris_sdk::LowState &s = instance.state();
+    const size_t dheader     = std::is_same<S, xcdr_v2_stream>::value ? 4 : 0;
+
+    if (P & ::igris_sdk::LOWSTATE_TICK) {
+        str.position(Cdr::TICK);
+        if (!read(str, s.tick())) return false;
+    }
+    if (P & ::igris_sdk::LOWSTATE_IMU) {
+        ::igris_sdk::IMUState &imu = s.imu_state();
+        str.position(Cdr::IMU);
+        if (!read(str, imu.quaternion()[0], 4) || !read(str, imu.gyroscope()[0], 3) || !read(str, imu.accelerometer()[0], 3) ||
+            !read(str, imu.rpy()[0], 3))
+            return false;
+    }
+    if (P & ::igris_sdk::LOWSTATE_MOTOR) {
+        for (size_t i = F; i < F + C; i++) {
+            ::igris_sdk::MotorState &m = s.motor_state()[i];
+            const size_t base          = Cdr::motors(dheader) + i * Cdr::MOTOR_STRIDE;
+            if (P & ::igris_sdk::LOWSTATE_MOTOR_Q) {
+                str.position(base);
+                if (!read(str, m.q())) return false;
+            }
+            if (P & ::igris_sdk::LOWSTATE_MOTOR_DQ) {
+                str.position(base + 4);
+                if (!read(str, m.dq())) return false;
+            }
+            if (P & ::igris_sdk::LOWSTATE_MOTOR_TAU) {
+                str.position(base + 8);
+                if (!read(str, m.tau_est())) return false;
+            }
+            if (P & ::igris_sdk::LOWSTATE_MOTOR_TEMPERATURE) {
+                str.position(base + 12);
+                if (!read(str, m.temperature())) return false;
+            }
+            if (P & ::igris_sdk::LOWSTATE_MOTOR_STATUS) {
+                str.position(base + 16);
+                if (!read(str, m.status_bits())) return false;
+            }
+        }
+    }
+    if (P & ::igris_sdk::LOWSTATE_JOINT) {
+        for (size_t i = F; i < F + C; i++) {
+            ::igris_sdk::JointState &j = s.joint_state()[i];
+            const size_t base          = Cdr::joints(dheader) + i * Cdr::JOINT_STRIDE;
+            if (P & ::igris_sdk::LOWSTATE_JOINT_Q) {
+                str.position(base);
+                if (!read(str, j.q())) return false;
+            }
+            if (P & ::igris_sdk::LOWSTATE_JOINT_DQ) {
+                str.position(base + 4);
+                if (!read(str, j.dq())) return false;
+            }
+            if (P & ::igris_sdk::LOWSTATE_JOINT_TAU) {
+                str.position(base + 8);
+                if (!read(str, j.tau_est())) return false;
+            }
+            if (P & ::igris_sdk::LOWSTATE_JOINT_STATUS) {
+                str.position(base + 12);
+                if (!read(str, j.status_bits())) return false;
+            }
+        }
+    }
+    return true;
+}
+
+// Serializing a view writes it as a full LowState (unselected fields zero)
+template <typename S, uint32_t P, uint32_t F, uint32_t C, std::enable_if_t<std::is_base_of<cdr_stream, S>::value, bool> = true>
+bool write(S &str, const ::igris_sdk::LowStateView<P, F, C> &instance, bool as_key) {
+    return write(str, instance.state(), as_key);
+}
+
+template <typename S, uint32_t P, uint32_t F, uint32_t C, std::enable_if_t<std::is_base_of<cdr_stream, S>::value, bool> = true>
+bool move(S &str, const ::igris_sdk::LowStateView<P, F, C> &instance, bool as_key) {
+    return move(str, instance.state(), as_key);
+}
+
+template <typename S, uint32_t P, uint32_t F, uint32_t C, std::enable_if_t<std::is_base_of<cdr_stream, S>::value, bool> = true>
+bool max(S &str, const ::igris_sdk::LowStateView<P, F, C> &instance, bool as_key) {
+    return max(str, instance.state(), as_key);
+}
+
+}  // namespace cdr
+}  // namespace core
+
+namespace topic {
+
+// Same DDS type (name, type information) as LowState, own serdata/sertype ops
+template <uint32_t P, uint32_t F, uint32_t C>
+class TopicTraits<::igris_sdk::LowStateView<P, F, C>> : public TopicTraits<::igris_c::msg::dds::LowState> {
+  public:
+    using View = ::igris_sdk::LowStateView<P, F, C>;
+
+    static ddsi_sertype *getSerType(allowable_encodings_t kinds = allowableEncodings()) {
+        if (kinds & allowableEncodings() & DDS_DATA_REPRESENTATION_FLAG_XCDR1)
+            return static_cast<ddsi_sertype *>(new ddscxx_sertype<View, basic_cdr_stream>());
+        else if (kinds & allowableEncodings() & DDS_DATA_REPRESENTATION_FLAG_XCDR2)
+            return static_cast<ddsi_sertype *>(new ddscxx_sertype<View, xcdr_v2_stream>());
+        else
+            return nullptr;
+    }
+
+    static constexpr size_t getSampleSize() { return sizeof(View); }
+
+    static struct ddsi_sertype *deriveSertype(const struct ddsi_sertype *, dds_data_representation_id_t data_representation,
+                                              dds_type_consistency_enforcement_qospolicy_t) {
+        struct ddsi_sertype *ptr = nullptr;
+        switch (data_representation) {
+        case DDS_DATA_REPRESENTATION_XCDR1:
+            ptr = getSerType(DDS_DATA_REPRESENTATION_FLAG_XCDR1);
+            break;
+        case DDS_DATA_REPRESENTATION_XCDR2:
+            ptr = getSerType(DDS_DATA_REPRESENTATION_FLAG_XCDR2);
+            break;
+        }
+        if (ptr) {
+            uint32_t refc = ddsrt_atomic_ld32(&ptr->flags_refc);
+            ddsrt_atomic_st32(&ptr->flags_refc, refc & ~DDSI_SERTYPE_REFC_MASK);
+        }
+        return ptr;
+    }
+};
+
+}  // namespace topic
+}  // namespace cyclonedds
+}  // namespace eclipse
+}  // namespace org
+
+namespace dds {
+namespace topic {
+
+template <uint32_t P, uint32_t F, uint32_t C> struct topic_type_name<::igris_sdk::LowStateView<P, F, C>> {
+    static std::string value() { return org::eclipse::cyclonedds::topic::TopicTraits<::igris_c::msg::dds::LowState>::getTypeName(); }
+};
+
+template <uint32_t P, uint32_t F, uint32_t C> struct is_topic_type<::igris_sdk::LowStateView<P, F, C>> {
+    enum { value = 1 };
+};
+
+}  // namespace topic
+}  // namespace dds
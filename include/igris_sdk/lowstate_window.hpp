@@ -0,0 +1,212 @@
+#pragma once
+
+#include "igris_sdk/types.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+
+namespace igris_sdk {
+
+namespace detail {
+
+// Float fields of a LowState in a fixed order: motor q/dq/tau, joint q/dq/tau, IMU quaternion/gyro/accel/rpy
+constexpr size_t LOWSTATE_FLOATS = 6 * N_JOINTS + 13;
+constexpr size_t LOWSTATE_QUAT   = 6 * N_JOINTS;       // Offset of the IMU quaternion (4 floats)
+constexpr size_t LOWSTATE_RPY    = LOWSTATE_QUAT + 10;  // Offset of the IMU rpy (3 floats)
+
+inline void flatten_low_state(const LowState &state, float *out) {
+    for (size_t i = 0; i < N_JOINTS; i++) {
+        const MotorState &m   = state.motor_state()[i];
+        const JointState &j   = state.joint_state()[i];
+        out[i]                = m.q();
+        out[N_JOINTS + i]     = m.dq();
+        out[2 * N_JOINTS + i] = m.tau_est();
+        out[3 * N_JOINTS + i] = j.q();
+        out[4 * N_JOINTS + i] = j.dq();
+        out[5 * N_JOINTS + i] = j.tau_est();
+    }
+    const IMUState &imu = state.imu_state();
+    float *o            = out + 6 * N_JOINTS;
+    o                   = std::copy(imu.quaternion().begin(), imu.quaternion().end(), o);
+    o                   = std::copy(imu.gyroscope().begin(), imu.gyroscope().end(), o);
+    o                   = std::copy(imu.accelerometer().begin(), imu.accelerometer().end(), o);
+    std::copy(imu.rpy().begin(), imu.rpy().end(), o);
+}
+
+inline void unflatten_low_state(const float *in, LowState &state) {
+    for (size_t i = 0; i < N_JOINTS; i++) {
+        MotorState &m = state.motor_state()[i];
+        JointState &j = state.joint_state()[i];
+        m.q(in[i]);
+        m.dq(in[N_JOINTS + i]);
+        m.tau_est(in[2 * N_JOINTS + i]);
+        j.q(in[3 * N_JOINTS + i]);
+        j.dq(in[4 * N_JOINTS + i]);
+        j.tau_est(in[5 * N_JOINTS + i]);
+    }
+    IMUState &imu  = state.imu_state();
+    const float *p = in + 6 * N_JOINTS;
+    std::copy(p, p + 4, imu.quaternion().begin());
+    std::copy(p + 4, p + 7, imu.gyroscope().begin());
+    std::copy(p + 7, p + 10, imu.accelerometer().begin());
+    std::copy(p + 10, p + 13, imu.rpy().begin());
+}
+
+}  // namespace detail
+
+/**
+ * @brief Min/max/mean of the LowState samples of one window
+ *
+ * Float fields (positions, velocities, torques, gyro, accel) are aggregated per
+ * field; temperatures likewise. Orientation is not a per-component quantity:
+ * rpy gets the circular mean (atan2 of the mean sin/cos, so a window crossing
+ * +-pi stays near +-pi), and the quaternion the normalized mean of the samples
+ * sign-aligned to the window's first one (q and -q are the same rotation).
+ * Orientation has no min/max, so the min/max outputs carry the mean there.
+ * status_bits are OR-ed over the window in all three outputs, so a fault raised
+ * for a single sample is never decimated away, and tick is the last sample's.
+ * With quantum > 0 the float outputs are rounded to multiples of quantum.
+ *
+ * Not thread-safe; LowStateRelay serializes access.
+ *
+ * Example:
+ * @code
+ * LowStateWindow window;
+ * for (...) window.push(state);          // e.g. 50 samples at 500Hz
+ * LowState mean, min, max;
+ * window.take(mean, &min, &max, 1e-3f);  // 10Hz output, 1e-3 resolution
+ * @endcode
+ */
+class LowStateWindow {
+  public:
+    LowStateWindow() { reset(); }
+
+    void push(const LowState &state) {
+        detail::flatten_low_state(state, sample_.data());
+        for (size_t k = 0; k < detail::LOWSTATE_FLOATS; k++) {
+            sum_[k] += sample_[k];
+            min_[k] = std::min(min_[k], sample_[k]);
+            max_[k] = std::max(max_[k], sample_[k]);
+        }
+        push_orientation(sample_.data());
+        for (size_t i = 0; i < N_JOINTS; i++) {
+            const MotorState &m = state.motor_state()[i];
+            temp_sum_[i] += m.temperature();
+            temp_min_[i] = std::min(temp_min_[i], m.temperature());
+            temp_max_[i] = std::max(temp_max_[i], m.temperature());
+            motor_status_[i] |= m.status_bits();
+            joint_status_[i] |= state.joint_state()[i].status_bits();
+        }
+        tick_ = state.tick();
+        count_++;
+    }
+
+    // Samples in the current window
+    size_t count() const { return count_; }
+
+    // Write the window's mean (and min/max if given) and start a new window; false if the window is empty
+    bool take(LowState &mean, LowState *min = nullptr, LowState *max = nullptr, float quantum = 0.0f) {
+        if (count_ == 0) return false;
+
+        const double inv = 1.0 / static_cast<double>(count_);
+        for (size_t k = 0; k < detail::LOWSTATE_FLOATS; k++) sample_[k] = static_cast<float>(sum_[k] * inv);
+        mean_orientation(sample_.data());
+        emit(sample_.data(), mean, quantum);
+        for (size_t i = 0; i < N_JOINTS; i++) {
+            mean.motor_state()[i].temperature(static_cast<int16_t>(std::lround(temp_sum_[i] * inv)));
+        }
+        if (min) {
+            copy_orientation(sample_.data(), min_.data());
+            emit(min_.data(), *min, quantum);
+            for (size_t i = 0; i < N_JOINTS; i++) min->motor_state()[i].temperature(temp_min_[i]);
+        }
+        if (max) {
+            copy_orientation(sample_.data(), max_.data());
+            emit(max_.data(), *max, quantum);
+            for (size_t i = 0; i < N_JOINTS; i++) max->motor_state()[i].temperature(temp_max_[i]);
+        }
+        reset();
+        return true;
+    }
+
+    void reset() {
+        count_ = 0;
+        sum_.fill(0.0);
+        min_.fill(std::numeric_limits<float>::infinity());
+        max_.fill(-std::numeric_limits<float>::infinity());
+        temp_sum_.fill(0);
+        temp_min_.fill(std::numeric_limits<int16_t>::max());
+        temp_max_.fill(std::numeric_limits<int16_t>::min());
+        motor_status_.fill(0);
+        joint_status_.fill(0);
+        quat_sum_.fill(0.0);
+        rpy_sin_.fill(0.0);
+        rpy_cos_.fill(0.0);
+    }
+
+  private:
+    // Quaternion summed sign-aligned to the window's first sample, rpy as sin/cos
+    void push_orientation(const float *v) {
+        const float *q = v + detail::LOWSTATE_QUAT;
+        if (count_ == 0) std::copy(q, q + 4, quat_ref_.begin());
+        const float dot  = q[0] * quat_ref_[0] + q[1] * quat_ref_[1] + q[2] * quat_ref_[2] + q[3] * quat_ref_[3];
+        const double sgn = dot < 0.0f ? -1.0 : 1.0;
+        for (size_t c = 0; c < 4; c++) quat_sum_[c] += sgn * q[c];
+        for (size_t c = 0; c < 3; c++) {
+            const double a = v[detail::LOWSTATE_RPY + c];
+            rpy_sin_[c] += std::sin(a);
+            rpy_cos_[c] += std::cos(a);
+        }
+    }
+
+    // Overwrite the per-component means of the orientation fields in v
+    void mean_orientation(float *v) const {
+        const double norm = std::sqrt(quat_sum_[0] * quat_sum_[0] + quat_sum_[1] * quat_sum_[1] + quat_sum_[2] * quat_sum_[2] +
+                                      quat_sum_[3] * quat_sum_[3]);
+        for (size_t c = 0; c < 4; c++) v[detail::LOWSTATE_QUAT + c] = norm > 0.0 ? static_cast<float>(quat_sum_[c] / norm) : 0.0f;
+        for (size_t c = 0; c < 3; c++) v[detail::LOWSTATE_RPY + c] = static_cast<float>(std::atan2(rpy_sin_[c], rpy_cos_[c]));
+    }
+
+    static void copy_orientation(const float *from, float *to) {
+        std::copy(from + detail::LOWSTATE_QUAT, from + detail::LOWSTATE_QUAT + 4, to + detail::LOWSTATE_QUAT);
+        std::copy(from + detail::LOWSTATE_RPY, from + detail::LOWSTATE_RPY + 3, to + detail::LOWSTATE_RPY);
+    }
+
+    void emit(const float *values, LowState &out, float quantum) {
+        const float *src = values;
+        if (quantum > 0.0f) {
+            const float inv_q = 1.0f / quantum;
+            for (size_t k = 0; k < detail::LOWSTATE_FLOATS; k++) quantized_[k] = std::nearbyint(values[k] * inv_q) * quantum;
+            src = quantized_.data();
+        }
+        detail::unflatten_low_state(src, out);
+        for (size_t i = 0; i < N_JOINTS; i++) {
+            out.motor_state()[i].status_bits(motor_status_[i]);
+            out.joint_state()[i].status_bits(joint_status_[i]);
+        }
+        out.tick(tick_);
+    }
+
+    size_t count_  = 0;
+    uint32_t tick_ = 0;
+    std::array<double, detail::LOWSTATE_FLOATS> sum_;
+    std::array<float, detail::LOWSTATE_FLOATS> min_;
+    std::array<float, detail::LOWSTATE_FLOATS> max_;
+    std::array<float, detail::LOWSTATE_FLOATS> sample_;
+    std::array<float, detail::LOWSTATE_FLOATS> quantized_;
+    std::array<int64_t, N_JOINTS> temp_sum_;
+    std::array<int16_t, N_JOINTS> temp_min_;
+    std::array<int16_t, N_JOINTS> temp_max_;
+    std::array<uint32_t, N_JOINTS> motor_status_;
+    std::array<uint32_t, N_JOINTS> joint_status_;
+    std::array<float, 4> quat_ref_{};
+    std::array<double, 4> quat_sum_;
+    std::array<double, 3> rpy_sin_;
+    std::array<double, 3> rpy_cos_;
+};
+
+}  // namespace igris_sdk
@@ -0,0 +1,192 @@
+#pragma once
+
+#include "igris_sdk/spsc_queue.hpp"
+#include "igris_sdk/types.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#endif
+
+namespace igris_sdk {
+
+// Number of bit positions tracked in MotorState.status_bits
+constexpr size_t N_STATUS_BITS = 32;
+
+// Name of a single MotorError flag ("UNKNOWN" for bits not defined in types.hpp)
+inline const char *motor_error_name(uint32_t flag) {
+    switch (flag) {
+        case INITIALIZE_ERROR: return "INITIALIZE_ERROR";
+        case PACKET_NOT_RECEIVED_ERROR: return "PACKET_NOT_RECEIVED_ERROR";
+        case MOTOR_STALL_ERROR: return "MOTOR_STALL_ERROR";
+        case LOW_VOLTAGE_ERROR: return "LOW_VOLTAGE_ERROR";
+        case OVER_VOLTAGE_ERROR: return "OVER_VOLTAGE_ERROR";
+        case OVER_CURRENT_ERROR: return "OVER_CURRENT_ERROR";
+        case POWER_OVERRUN_ERROR: return "POWER_OVERRUN_ERROR";
+        case CALIBRATION_PARAMETER_WRITING_ERROR: return "CALIBRATION_PARAMETER_WRITING_ERROR";
+        case SPEEDING_ERROR: return "SPEEDING_ERROR";
+        case COMPONENT_OVERTEMPERATURE_ERROR: return "COMPONENT_OVERTEMPERATURE_ERROR";
+        case MOTOR_TEMPERATURE_OVER_TEMPERATURE_ERROR: return "MOTOR_TEMPERATURE_OVER_TEMPERATURE_ERROR";
+        case ENCODER_CALIBRATION_ERROR: return "ENCODER_CALIBRATION_ERROR";
+        case ENCODER_DATA_ERROR: return "ENCODER_DATA_ERROR";
+        case MOTOR_BRAKE_VOLTAGE_TOO_HIGH_ERROR: return "MOTOR_BRAKE_VOLTAGE_TOO_HIGH_ERROR";
+        case DRV_DRIVE_ERROR: return "DRV_DRIVE_ERROR";
+        default: return "UNKNOWN";
+    }
+}
+
+/**
+ * @brief One status flag of one motor changing state
+ */
+struct MotorFaultEvent {
+    uint32_t tick  = 0;  // LowState tick of the sample that showed the change
+    uint16_t motor = 0;  // Motor index
+    uint32_t flag  = 0;  // Single MotorError bit
+    bool raised    = false;  // true: flag set, false: flag cleared
+};
+
+/**
+ * @brief Decodes MotorState.status_bits into fault transition events
+ *
+ * update() compares the 31 status words with the previous sample using SIMD
+ * compares, so a sample without changes costs a gather and a handful of
+ * instructions. Only changed motors are decoded bit by bit; every raised or
+ * cleared flag becomes a MotorFaultEvent in a lock-free SPSC queue and bumps a
+ * per-flag counter. The first sample reports every flag that is already set.
+ *
+ * Threading: update() on one thread (e.g. the Subscriber<LowState> callback),
+ * pop() on one other thread. The query functions may be called from anywhere.
+ *
+ * Example:
+ * @code
+ * MotorStatusMonitor monitor;
+ * sub.init([&](const LowState &s) { monitor.update(s); });
+ * ...
+ * MotorFaultEvent ev;
+ * while (monitor.pop(ev)) {
+ *     std::cout << "motor " << ev.motor << " " << motor_error_name(ev.flag) << (ev.raised ? " raised" : " cleared") << std::endl;
+ * }
+ * @endcode
+ */
+class MotorStatusMonitor {
+  public:
+    explicit MotorStatusMonitor(size_t queue_capacity = 1024) : events_(queue_capacity) {}
+
+    // Process one sample; returns the number of transitions found
+    size_t update(const LowState &state);
+
+    // Next transition event, if any
+    bool pop(MotorFaultEvent &event) { return events_.pop(event); }
+
+    // Flags currently set on a motor
+    uint32_t status(uint16_t motor) const { return motor < N_JOINTS ? current_[motor].load(std::memory_order_relaxed) : 0; }
+
+    // OR of the flags currently set on any motor
+    uint32_t active_flags() const { return active_flags_.load(std::memory_order_relaxed); }
+
+    // Number of times a flag was raised / cleared on any motor (flag: single MotorError bit)
+    uint64_t raised_count(uint32_t flag) const { return counter(raised_, flag); }
+    uint64_t cleared_count(uint32_t flag) const { return counter(cleared_, flag); }
+
+    // Transitions lost because the queue was full
+    uint64_t dropped_events() const { return dropped_.load(std::memory_order_relaxed); }
+
+  private:
+    static constexpr size_t LANES = 32;
+
+    static size_t bit_index(uint32_t flag) { return flag ? static_cast<size_t>(__builtin_ctz(flag)) : N_STATUS_BITS; }
+
+    uint64_t counter(const std::atomic<uint64_t> *counters, uint32_t flag) const {
+        size_t i = bit_index(flag);
+        return i < N_STATUS_BITS ? counters[i].load(std::memory_order_relaxed) : 0;
+    }
+
+    // Bit m set if word m differs between a and b
+    static uint32_t changed_mask(const uint32_t *a, const uint32_t *b);
+
+    void emit(uint32_t tick, uint16_t motor, uint32_t before, uint32_t after);
+
+    SpscQueue<MotorFaultEvent> events_;
+
+    // Status words of the previous sample (producer only), padding lane stays 0
+    alignas(32) uint32_t prev_[LANES] = {};
+    alignas(32) uint32_t next_[LANES] = {};
+
+    std::atomic<uint32_t> current_[N_JOINTS] = {};
+    std::atomic<uint32_t> active_flags_{0};
+    std::atomic<uint64_t> raised_[N_STATUS_BITS]  = {};
+    std::atomic<uint64_t> cleared_[N_STATUS_BITS] = {};
+    std::atomic<uint64_t> dropped_{0};
+};
+
+inline uint32_t MotorStatusMonitor::changed_mask(const uint32_t *a, const uint32_t *b) {
+    uint32_t mask = 0;
+#if defined(__AVX2__)
+    for (size_t i = 0; i < LANES; i += 8) {
+        __m256i eq = _mm256_cmpeq_epi32(_mm256_load_si256(reinterpret_cast<const __m256i *>(a + i)),
+                                        _mm256_load_si256(reinterpret_cast<const __m256i *>(b + i)));
+        mask |= static_cast<uint32_t>(~_mm256_movemask_ps(_mm256_castsi256_ps(eq)) & 0xFF) << i;
+    }
+#elif defined(__SSE2__) || defined(_M_X64)
+    for (size_t i = 0; i < LANES; i += 4) {
+        __m128i eq = _mm_cmpeq_epi32(_mm_load_si128(reinterpret_cast<const __m128i *>(a + i)),
+                                     _mm_load_si128(reinterpret_cast<const __m128i *>(b + i)));
+        mask |= static_cast<uint32_t>(~_mm_movemask_ps(_mm_castsi128_ps(eq)) & 0xF) << i;
+    }
+#else
+    for (size_t i = 0; i < LANES; i++) {
+        mask |= static_cast<uint32_t>(a[i] != b[i]) << i;
+    }
+#endif
+    return mask;
+}
+
+inline void MotorStatusMonitor::emit(uint32_t tick, uint16_t motor, uint32_t before, uint32_t after) {
+    uint32_t diff = before ^ after;
+    while (diff) {
+        uint32_t flag = diff & (~diff + 1);  // lowest set bit
+        diff ^= flag;
+        MotorFaultEvent event;
+        event.tick   = tick;
+        event.motor  = motor;
+        event.flag   = flag;
+        event.raised = (after & flag) != 0;
+        (event.raised ? raised_ : cleared_)[bit_index(flag)].fetch_add(1, std::memory_order_relaxed);
+        if (!events_.push(event)) {
+            dropped_.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+}
+
+inline size_t MotorStatusMonitor::update(const LowState &state) {
+    const auto &motors = state.motor_state();
+    for (size_t i = 0; i < N_JOINTS; i++) {
+        next_[i] = motors[i].status_bits();
+    }
+
+    uint32_t changed = changed_mask(prev_, next_);
+    if (!changed) return 0;
+
+    size_t transitions = 0;
+    uint32_t active    = 0;
+    for (size_t i = 0; i < N_JOINTS; i++) {
+        active |= next_[i];
+    }
+    while (changed) {
+        size_t m = static_cast<size_t>(__builtin_ctz(changed));
+        changed &= changed - 1;
+        transitions += static_cast<size_t>(__builtin_popcount(prev_[m] ^ next_[m]));
+        emit(state.tick(), static_cast<uint16_t>(m), prev_[m], next_[m]);
+        current_[m].store(next_[m], std::memory_order_relaxed);
+        prev_[m] = next_[m];
+    }
+    active_flags_.store(active, std::memory_order_relaxed);
+    return transitions;
+}
+
+}  // namespace igris_sdk
@@ -1,26 +1,57 @@
 #pragma once
 
+#include "igris_sdk/channel_factory.hpp"
+#include "igris_sdk/dds_wait.hpp"
+#include "igris_sdk/entity_cache.hpp"
+
 #include <dds/dds.hpp>
+#include <iostream>
 #include <memory>
 #include <string>
 
 namespace igris_sdk {
 
+// The constructor, destructor, init() and write() of the built-in message types are
+// instantiated in libigris_sdk.a. Members defined in this header (init(ChannelFactory &),
+// wait_for_subscribers(), ...) are not: they are instantiated in the including TU for
+// every type, so they must never be declared extern (see publisher_impl.hpp).
 template <typename MessageType> class Publisher {
   public:
     Publisher(const std::string &topic_name);
     ~Publisher();
 
     // Initialize DDS publisher (Cyclone DDS)
-    // Note: ChannelFactory must be initialized before calling this
+    // Note: ChannelFactory must be initialized before calling this. For the built-in
+    // message types this is library code that ignores ChannelFactory::SetPartition().
     bool init();
 
+    // Initialize on a given factory instead of ChannelFactory::Instance(),
+    // e.g. one factory (DomainParticipant) per robot domain
+    bool init(ChannelFactory &factory);
+
     // Publish a message
     bool write(const MessageType &msg);
 
+    // Publish a message after filter.apply(msg) (e.g. CommandFilter for LowCmd), which may modify it in place.
+    // Nothing is written if the filter rejects the message.
+    template <typename Filter> bool write(MessageType &msg, Filter &filter) { return filter.apply(msg) && write(msg); }
+
     // Check if publisher is initialized
     bool is_initialized() const { return initialized_; }
 
+    // Block until at least n readers are matched (publication-matched status, no polling).
+    // Messages written before the robot's reader has matched are lost; call this after init().
+    // Returns false on timeout or if not initialized.
+    bool wait_for_subscribers(int32_t n = 1, int timeout_ms = 5000) {
+        if (!initialized_) return false;
+        dds::core::cond::StatusCondition cond(*writer_);
+        cond.enabled_statuses(dds::core::status::StatusMask::publication_matched());
+        return detail::wait_for_condition(cond, [&] { return writer_->publication_matched_status().current_count() >= n; }, timeout_ms);
+    }
+
+    // Number of currently matched readers
+    int32_t matched_subscribers() const { return initialized_ ? writer_->publication_matched_status().current_count() : 0; }
+
   private:
     std::string topic_name_;
     bool initialized_;
@@ -30,4 +61,40 @@ template <typename MessageType> class Publisher {
     std::shared_ptr<dds::pub::DataWriter<MessageType>> writer_;
 };
 
+template <typename MessageType> inline bool Publisher<MessageType>::init(ChannelFactory &factory) {
+    if (initialized_) {
+        std::cerr << "[Publisher] Already initialized" << std::endl;
+        return false;
+    }
+
+    try {
+        auto participant = factory.GetParticipant();
+        if (!participant) {
+            std::cerr << "[Publisher] ChannelFactory not initialized. Call Init() first." << std::endl;
+            return false;
+        }
+
+        // Topic and Publisher entities are shared with the other endpoints of this
+        // participant and partition (see ChannelFactory::SetPartition())
+        dds::pub::qos::PublisherQos publisher_qos = participant->default_publisher_qos();
+        std::string partition                     = factory.GetPartition();
+        if (!partition.empty()) publisher_qos << dds::core::policy::Partition(partition);
+        topic_     = EntityCache::Instance().topic<MessageType>(*participant, topic_name_);
+        publisher_ = EntityCache::Instance().publisher(*participant, publisher_qos);
+
+        // RELIABLE (100ms max blocking) + KEEP_LAST 10, same as the built-in topics
+        dds::pub::qos::DataWriterQos qos = publisher_->default_datawriter_qos();
+        qos << dds::core::policy::Reliability::Reliable(dds::core::Duration::from_millisecs(100)) << dds::core::policy::History::KeepLast(10);
+
+        writer_ = std::make_shared<dds::pub::DataWriter<MessageType>>(*publisher_, *topic_, qos, nullptr, dds::core::status::StatusMask::none());
+
+        initialized_ = true;
+        std::cout << "[Publisher] Initialized topic: " << topic_name_ << std::endl;
+        return true;
+    } catch (const dds::core::Exception &e) {
+        std::cerr << "[Publisher] DDS Exception: " << e.what() << std::endl;
+        return false;
+    }
+}
+
 }  // namespace igris_sdk
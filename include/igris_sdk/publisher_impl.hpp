@@ -0,0 +1,71 @@
+#pragma once
+
+/**
+ * @brief Template definitions of Publisher<T>
+ *
+ * publisher.hpp only declares Publisher<T>; libigris_sdk.a instantiates it for the
+ * built-in igris_c::msg::dds types. Include this header instead of publisher.hpp
+ * to publish your own IDL types (generated with idlc -l cxx) through the same
+ * machinery; for those types the compiler can also inline write() into the
+ * control loop. The library members of the built-in types (constructor,
+ * destructor, init(), write()) stay extern templates: they link against the
+ * instantiations in libigris_sdk.a, so write() is an out-of-line call for
+ * built-in types whichever header is included.
+ *
+ * Example:
+ * @code
+ * #include "igris_sdk/publisher_impl.hpp"
+ * #include "my_msgs.hpp"
+ *
+ * igris_sdk::Publisher<my_msgs::FootForce> pub("rt/foot_force");
+ * pub.init();
+ * @endcode
+ */
+
+#include "igris_sdk/channel_factory.hpp"
+#include "igris_sdk/igris_c_msgs.hpp"
+#include "igris_sdk/publisher.hpp"
+
+#include <iostream>
+
+namespace igris_sdk {
+
+template <typename MessageType> Publisher<MessageType>::Publisher(const std::string &topic_name) : topic_name_(topic_name), initialized_(false) {}
+
+template <typename MessageType> Publisher<MessageType>::~Publisher() {}
+
+template <typename MessageType> bool Publisher<MessageType>::init() { return init(*ChannelFactory::Instance()); }
+
+template <typename MessageType> bool Publisher<MessageType>::write(const MessageType &msg) {
+    if (!initialized_) return false;
+
+    try {
+        writer_->write(msg);
+        return true;
+    } catch (const dds::core::Exception &e) {
+        std::cerr << "[Publisher] Write failed: " << e.what() << std::endl;
+        return false;
+    }
+}
+
+// Members instantiated in libigris_sdk.a for the built-in types. Only these are extern:
+// header-only members (init(ChannelFactory &), wait_for_subscribers(), ...) are not in the
+// library and must still be instantiated implicitly, including at -O0 where nothing inlines.
+#define IGRIS_SDK_EXTERN_PUBLISHER(T)                                 \
+    extern template Publisher<T>::Publisher(const std::string &);    \
+    extern template Publisher<T>::~Publisher();                      \
+    extern template bool Publisher<T>::init();                       \
+    extern template bool Publisher<T>::write(const T &);
+
+IGRIS_SDK_EXTERN_PUBLISHER(igris_c::msg::dds::LowCmd)
+IGRIS_SDK_EXTERN_PUBLISHER(igris_c::msg::dds::LowState)
+IGRIS_SDK_EXTERN_PUBLISHER(igris_c::msg::dds::BmsState)
+IGRIS_SDK_EXTERN_PUBLISHER(igris_c::msg::dds::BmsInitCmd)
+IGRIS_SDK_EXTERN_PUBLISHER(igris_c::msg::dds::TorqueCmd)
+IGRIS_SDK_EXTERN_PUBLISHER(igris_c::msg::dds::ControlModeCmd)
+IGRIS_SDK_EXTERN_PUBLISHER(igris_c::msg::dds::ControlModeState)
+IGRIS_SDK_EXTERN_PUBLISHER(igris_c::msg::dds::ServiceResponse)
+
+#undef IGRIS_SDK_EXTERN_PUBLISHER
+
+}  // namespace igris_sdk
@@ -0,0 +1,110 @@
+#pragma once
+
+#include "igris_sdk/subscriber.hpp"
+
+#include <atomic>
+#include <dds/dds.hpp>
+#include <iostream>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace igris_sdk {
+
+/**
+ * @brief One receive thread for many subscribers
+ *
+ * Each Subscriber<T> normally runs its own listener thread polling take() every
+ * 1ms, so a process holding many robots pays one thread and 1000 wake-ups per
+ * second per subscriber. A ReceiveThread instead blocks on a single wait set
+ * with a read condition per subscriber and runs the callbacks of subscribers
+ * that have data, on its own thread. Subscribers of different domains
+ * (ChannelFactory instances) can share one ReceiveThread.
+ *
+ * Subscribers must be initialized with init(factory, callback, false) so that
+ * they do not start their own listener, and must outlive the ReceiveThread.
+ *
+ * Example:
+ * @code
+ * ReceiveThread receiver;
+ * for (auto &robot : robots) {
+ *     robot.state_sub.init(robot.factory, callback, false);
+ *     receiver.add(robot.state_sub);
+ * }
+ * receiver.start();
+ * @endcode
+ */
+class ReceiveThread {
+  public:
+    ReceiveThread() { waitset_.attach_condition(wake_); }
+    ~ReceiveThread() { stop(); }
+
+    ReceiveThread(const ReceiveThread &)            = delete;
+    ReceiveThread &operator=(const ReceiveThread &) = delete;
+
+    // Deliver the samples of sub on this thread (may be called while running)
+    template <typename MessageType> bool add(Subscriber<MessageType> &sub) {
+        if (!sub.is_initialized() || sub.is_running()) {
+            std::cerr << "[ReceiveThread] Subscriber must be initialized without its listener thread" << std::endl;
+            return false;
+        }
+        try {
+            dds::sub::cond::ReadCondition cond(sub.reader(), dds::sub::status::DataState::any(),
+                                               [&sub](dds::core::cond::Condition &) { sub.poll(); });
+            std::lock_guard<std::mutex> lock(mutex_);
+            waitset_.attach_condition(cond);
+            conditions_.push_back(cond);
+        } catch (const dds::core::Exception &e) {
+            std::cerr << "[ReceiveThread] DDS Exception: " << e.what() << std::endl;
+            return false;
+        }
+        return true;
+    }
+
+    bool start() {
+        if (running_.exchange(true)) {
+            std::cerr << "[ReceiveThread] Already running" << std::endl;
+            return false;
+        }
+        thread_ = std::thread(&ReceiveThread::run, this);
+        return true;
+    }
+
+    void stop() {
+        if (!running_.exchange(false)) return;
+        wake_.trigger_value(true);
+        if (thread_.joinable()) thread_.join();
+        wake_.trigger_value(false);
+    }
+
+    bool is_running() const { return running_; }
+
+    // Number of subscribers served
+    size_t size() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return conditions_.size();
+    }
+
+  private:
+    void run() {
+        while (running_) {
+            try {
+                // Runs the functor of every read condition with data; the guard only wakes stop()
+                waitset_.dispatch(dds::core::Duration::from_millisecs(100));
+            } catch (const dds::core::TimeoutError &) {
+            } catch (const dds::core::Exception &e) {
+                std::cerr << "[ReceiveThread] DDS Exception: " << e.what() << std::endl;
+            }
+        }
+    }
+
+    dds::core::cond::WaitSet waitset_;
+    dds::core::cond::GuardCondition wake_;
+    std::vector<dds::sub::cond::ReadCondition> conditions_;  // Keeps the conditions alive
+
+    mutable std::mutex mutex_;
+    std::thread thread_;
+    std::atomic<bool> running_{false};
+};
+
+}  // namespace igris_sdk
@@ -0,0 +1,238 @@
+#pragma once
+
+#include "igris_sdk/clock_sync.hpp"
+#include "igris_sdk/joint_math.hpp"
+#include "igris_sdk/types.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <mutex>
+
+namespace igris_sdk {
+
+/**
+ * @brief Configuration for StatePredictor
+ */
+struct StatePredictorConfig {
+    KinematicMode space = KinematicMode::PJS;  // Predict joint_state (PJS) or motor_state (MS)
+
+    // Constant-acceleration alpha-beta-gamma gains (steady-state Kalman filter).
+    // alpha weights the measured q, beta the measured dq, gamma the acceleration update.
+    float alpha = 1.0f;
+    float beta  = 0.6f;
+    float gamma = 0.1f;
+
+    double horizon_us     = -1.0;     // Fixed prediction lead past now(); < 0: auto (half the round trip)
+    double max_horizon_us = 50000.0;  // Cap on the extrapolation from the last sample
+    double rtt_alpha      = 0.05;     // EWMA factor for round-trip latency samples
+    bool quaternion_wxyz  = true;     // IMUState.quaternion order (w, x, y, z); false: (x, y, z, w)
+};
+
+/**
+ * @brief Extrapolated robot state
+ */
+struct PredictedState {
+    uint64_t time_us = 0;  // Host time (steady clock) the prediction is for
+    float horizon_s  = 0;  // Extrapolation from the last sample
+    JointArray q{};
+    JointArray dq{};
+    std::array<float, 4> quaternion{};  // Same order as IMUState
+    std::array<float, 3> gyroscope{};
+};
+
+/**
+ * @brief Latency-compensating predictor for LowState
+ *
+ * Tracks q, dq and acceleration of every joint with a constant-acceleration
+ * alpha-beta-gamma filter (SIMD over all joints, see joint_math.hpp) and
+ * extrapolates them to the time the next command will take effect. The IMU
+ * orientation is propagated with the latest gyroscope rate (body frame).
+ *
+ * Sample times should be the robot's production time on the host clock: use
+ * update(state, sync) with a ClockSync, or pass a timestamp explicitly. The
+ * default horizon is auto-tuned to half the measured command round trip
+ * (add_round_trip_sample()); set horizon_us for a fixed lead.
+ *
+ * Thread-safe: update() from the Subscriber<LowState> callback, predict() from
+ * the control thread.
+ *
+ * Example:
+ * @code
+ * ClockSync sync;
+ * StatePredictor predictor;
+ * sub.init([&](const LowState &s) {
+ *     sync.add_sample(s);
+ *     predictor.update(s, sync);
+ * });
+ * ...
+ * PredictedState ps;
+ * if (predictor.predict(ps)) controller.compute(ps.q, ps.dq);
+ * @endcode
+ */
+class StatePredictor {
+  public:
+    explicit StatePredictor(const StatePredictorConfig &config = StatePredictorConfig()) : config_(config) {}
+
+    // Add a sample produced by the robot at host time sample_us (steady clock)
+    void update(const LowState &state, uint64_t sample_us);
+
+    // Add a sample, timed with the clock mapping if it is synced (receive time otherwise)
+    void update(const LowState &state, const ClockSync &sync) {
+        uint64_t t = sync.is_synced() ? sync.tick_to_host_time(state.tick()) : ClockSync::now_us();
+        update(state, t);
+    }
+
+    // Feed a measured command round trip (write -> effect visible in LowState), in microseconds
+    void add_round_trip_sample(double rtt_us) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        rtt_us_ = have_rtt_ ? rtt_us_ + config_.rtt_alpha * (rtt_us - rtt_us_) : rtt_us;
+        have_rtt_ = true;
+    }
+
+    // Lead past now() used by predict(ps)
+    double horizon_us() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return lead_us();
+    }
+
+    // Predict the state at host time target_us; false until the first sample
+    bool predict_at(uint64_t target_us, PredictedState &out) const;
+
+    // Predict the state at now() + horizon_us()
+    bool predict(PredictedState &out) const {
+        uint64_t target;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            target = ClockSync::now_us() + static_cast<uint64_t>(std::max(0.0, lead_us()));
+        }
+        return predict_at(target, out);
+    }
+
+    void reset() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        samples_ = 0;
+    }
+
+  private:
+    static constexpr size_t LANES = 32;
+
+    double lead_us() const {
+        if (config_.horizon_us >= 0.0) return config_.horizon_us;
+        return have_rtt_ ? 0.5 * rtt_us_ : 0.0;
+    }
+
+    // q += v t + a t^2 / 2, v += a t over all joints
+    static void extrapolate(const float *q, const float *v, const float *a, float t, float *q_out, float *v_out);
+
+    StatePredictorConfig config_;
+    mutable std::mutex mutex_;
+
+    size_t samples_     = 0;
+    uint64_t sample_us_ = 0;
+    double rtt_us_      = 0.0;
+    bool have_rtt_      = false;
+
+    // Filter state, padded to whole SIMD vectors
+    alignas(32) float q_[LANES]  = {};
+    alignas(32) float v_[LANES]  = {};
+    alignas(32) float a_[LANES]  = {};
+    alignas(32) float zq_[LANES] = {};
+    alignas(32) float zv_[LANES] = {};
+
+    std::array<float, 4> quat_{};
+    std::array<float, 3> gyro_{};
+};
+
+inline void StatePredictor::extrapolate(const float *q, const float *v, const float *a, float t, float *q_out, float *v_out) {
+    using S       = detail::JointVec;
+    const S::F vt = S::set1(t);
+    const S::F ht = S::set1(0.5f * t * t);
+    for (size_t i = 0; i < LANES; i += S::W) {
+        S::F vv = S::load(v + i), va = S::load(a + i);
+        S::store(q_out + i, S::add(S::load(q + i), S::add(S::mul(vv, vt), S::mul(va, ht))));
+        S::store(v_out + i, S::add(vv, S::mul(va, vt)));
+    }
+}
+
+inline void StatePredictor::update(const LowState &state, uint64_t sample_us) {
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    for (size_t i = 0; i < N_JOINTS; i++) {
+        if (config_.space == KinematicMode::MS) {
+            zq_[i] = state.motor_state()[i].q();
+            zv_[i] = state.motor_state()[i].dq();
+        } else {
+            zq_[i] = state.joint_state()[i].q();
+            zv_[i] = state.joint_state()[i].dq();
+        }
+    }
+    quat_ = state.imu_state().quaternion();
+    gyro_ = state.imu_state().gyroscope();
+
+    float dt = samples_ ? static_cast<float>(static_cast<int64_t>(sample_us - sample_us_)) * 1e-6f : 0.0f;
+    if (samples_ == 0 || dt <= 0.0f || dt > 1e-6f * static_cast<float>(config_.max_horizon_us)) {
+        // First sample, out of order, or after a gap: restart from the measurement
+        std::copy(zq_, zq_ + LANES, q_);
+        std::copy(zv_, zv_ + LANES, v_);
+        std::fill(a_, a_ + LANES, 0.0f);
+    } else {
+        // Predict to the sample time, then correct with the measured q and dq
+        alignas(32) float qp[LANES], vp[LANES];
+        extrapolate(q_, v_, a_, dt, qp, vp);
+
+        using S          = detail::JointVec;
+        const S::F alpha = S::set1(config_.alpha);
+        const S::F beta  = S::set1(config_.beta);
+        const S::F gdt   = S::set1(config_.gamma / dt);
+        for (size_t i = 0; i < LANES; i += S::W) {
+            S::F rq = S::sub(S::load(zq_ + i), S::load(qp + i));
+            S::F rv = S::sub(S::load(zv_ + i), S::load(vp + i));
+            S::store(q_ + i, S::add(S::load(qp + i), S::mul(alpha, rq)));
+            S::store(v_ + i, S::add(S::load(vp + i), S::mul(beta, rv)));
+            S::store(a_ + i, S::add(S::load(a_ + i), S::mul(gdt, rv)));
+        }
+    }
+    sample_us_ = sample_us;
+    samples_++;
+}
+
+inline bool StatePredictor::predict_at(uint64_t target_us, PredictedState &out) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (samples_ == 0) return false;
+
+    double lead = static_cast<double>(static_cast<int64_t>(target_us - sample_us_));
+    lead        = std::clamp(lead, 0.0, config_.max_horizon_us);
+    float t     = static_cast<float>(lead * 1e-6);
+
+    alignas(32) float q[LANES], v[LANES];
+    extrapolate(q_, v_, a_, t, q, v);
+    std::copy(q, q + N_JOINTS, out.q.begin());
+    std::copy(v, v + N_JOINTS, out.dq.begin());
+
+    // Orientation: q(t) = q0 * exp(omega t / 2), omega in the body frame
+    const bool wxyz = config_.quaternion_wxyz;
+    float w = quat_[wxyz ? 0 : 3], x = quat_[wxyz ? 1 : 0], y = quat_[wxyz ? 2 : 1], z = quat_[wxyz ? 3 : 2];
+    float half  = 0.5f * t;
+    float rx    = gyro_[0] * half, ry = gyro_[1] * half, rz = gyro_[2] * half;
+    float angle = std::sqrt(rx * rx + ry * ry + rz * rz);
+    float dw    = std::cos(angle);
+    float k     = angle > 1e-9f ? std::sin(angle) / angle : 1.0f;
+    float dx = rx * k, dy = ry * k, dz = rz * k;
+    float nw = w * dw - x * dx - y * dy - z * dz;
+    float nx = w * dx + x * dw + y * dz - z * dy;
+    float ny = w * dy - x * dz + y * dw + z * dx;
+    float nz = w * dz + x * dy - y * dx + z * dw;
+    if (wxyz) {
+        out.quaternion = {nw, nx, ny, nz};
+    } else {
+        out.quaternion = {nx, ny, nz, nw};
+    }
+    out.gyroscope = gyro_;
+    out.time_us   = sample_us_ + static_cast<uint64_t>(lead);
+    out.horizon_s = t;
+    return true;
+}
+
+}  // namespace igris_sdk
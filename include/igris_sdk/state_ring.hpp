@@ -0,0 +1,327 @@
+#pragma once
+
+#include "igris_sdk/types.hpp"
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+
+namespace igris_sdk {
+
+/**
+ * @brief Strided view of one column of a ring (buffer protocol layout)
+ *
+ * Mirrors the fields of a PEP 3118 buffer (pybind11::buffer_info), so a binding
+ * can hand the memory to NumPy without copying. Dimension 0 is the ring slot.
+ */
+struct ArrayView {
+    void *data           = nullptr;
+    size_t itemsize      = 0;
+    const char *format   = "";  // PEP 3118 format character ("f", "h", "I", "Q")
+    size_t ndim          = 0;  // 1: (slot), 2: (slot, width)
+    std::array<ptrdiff_t, 2> shape{};
+    std::array<ptrdiff_t, 2> strides{};  // Bytes
+};
+
+namespace detail {
+
+template <typename T> struct BufferFormat;
+template <> struct BufferFormat<float> { static constexpr const char *value = "f"; };
+template <> struct BufferFormat<int16_t> { static constexpr const char *value = "h"; };
+template <> struct BufferFormat<uint32_t> { static constexpr const char *value = "I"; };
+template <> struct BufferFormat<uint64_t> { static constexpr const char *value = "Q"; };
+
+// Layout of one ring column
+struct RingColumn {
+    size_t itemsize;
+    const char *format;
+    size_t width;  // Elements per sample; 1: shape (slot), otherwise (slot, width)
+};
+
+template <typename T> constexpr RingColumn scalar_column() { return {sizeof(T), BufferFormat<T>::value, 1}; }
+template <typename T> constexpr RingColumn vector_column(size_t n) { return {sizeof(T), BufferFormat<T>::value, n}; }
+
+/**
+ * @brief Single-writer ring of fixed-size samples stored column by column (SoA)
+ *
+ * All columns live in one allocation made at construction; column c of slot s is
+ * a contiguous run of width[c] elements. The writer publishes a sample by
+ * incrementing sequence() after filling its slot.
+ */
+template <size_t N_COLUMNS> class ColumnRing {
+  public:
+    ColumnRing(size_t capacity, const std::array<RingColumn, N_COLUMNS> &columns) : columns_(columns) {
+        size_t n = 2;
+        while (n < capacity) n <<= 1;
+        mask_ = n - 1;
+
+        size_t offset = 0;
+        for (size_t c = 0; c < N_COLUMNS; c++) {
+            offsets_[c] = offset;
+            offset += (n * columns_[c].itemsize * columns_[c].width + 63) & ~size_t(63);
+        }
+        bytes_   = offset;
+        storage_ = static_cast<uint8_t *>(::operator new(bytes_, std::align_val_t(64)));
+        std::memset(storage_, 0, bytes_);
+    }
+
+    ~ColumnRing() { ::operator delete(storage_, std::align_val_t(64)); }
+
+    ColumnRing(const ColumnRing &)            = delete;
+    ColumnRing &operator=(const ColumnRing &) = delete;
+
+    size_t capacity() const { return mask_ + 1; }
+
+    // Number of samples written since construction; sample seq lives in slot(seq)
+    uint64_t sequence() const { return sequence_.load(std::memory_order_acquire); }
+    size_t slot(uint64_t seq) const { return static_cast<size_t>(seq) & mask_; }
+
+    // True if sample seq has been published and not yet overwritten.
+    // Check again after reading a sample to detect a concurrent overwrite.
+    bool readable(uint64_t seq) const {
+        std::atomic_thread_fence(std::memory_order_acquire);
+        uint64_t written = sequence();
+        return seq < written && written - seq < capacity();
+    }
+
+    ArrayView view(size_t c) const {
+        const RingColumn &col = columns_[c];
+        ArrayView v;
+        v.data     = storage_ + offsets_[c];
+        v.itemsize = col.itemsize;
+        v.format   = col.format;
+        v.ndim     = col.width > 1 ? 2 : 1;
+        v.shape    = {static_cast<ptrdiff_t>(capacity()), static_cast<ptrdiff_t>(col.width)};
+        v.strides  = {static_cast<ptrdiff_t>(col.itemsize * col.width), static_cast<ptrdiff_t>(col.itemsize)};
+        return v;
+    }
+
+    // Writer: pointer to column c of the slot of the next sample
+    template <typename T> T *next(size_t c) {
+        size_t s = slot(sequence_.load(std::memory_order_relaxed));
+        return reinterpret_cast<T *>(storage_ + offsets_[c]) + s * columns_[c].width;
+    }
+
+    // Writer: make the sample filled through next() visible.
+    // The release fence keeps the increment ahead of the writes to the next slot (the
+    // writer side of a seqlock): a reader whose copy saw those writes also sees the new
+    // sequence in readable(). x86 orders stores anyway; ARM needs the barrier.
+    void publish() {
+        sequence_.fetch_add(1, std::memory_order_release);
+        std::atomic_thread_fence(std::memory_order_release);
+    }
+
+    // Reader: pointer to column c of sample seq
+    template <typename T> const T *at(size_t c, uint64_t seq) const {
+        return reinterpret_cast<const T *>(storage_ + offsets_[c]) + slot(seq) * columns_[c].width;
+    }
+
+    // Reader: copy column c of samples [first, first + count) into contiguous memory
+    void copy(size_t c, uint64_t first, size_t count, void *out) const {
+        const size_t row    = columns_[c].itemsize * columns_[c].width;
+        const size_t s      = slot(first);
+        const size_t n1     = count < capacity() - s ? count : capacity() - s;
+        const uint8_t *base = storage_ + offsets_[c];
+        std::memcpy(out, base + s * row, n1 * row);
+        std::memcpy(static_cast<uint8_t *>(out) + n1 * row, base, (count - n1) * row);
+    }
+
+  private:
+    std::array<RingColumn, N_COLUMNS> columns_;
+    std::array<size_t, N_COLUMNS> offsets_{};
+    size_t mask_      = 0;
+    size_t bytes_     = 0;
+    uint8_t *storage_ = nullptr;
+    alignas(64) std::atomic<uint64_t> sequence_{0};
+};
+
+}  // namespace detail
+
+enum class LowStateField : size_t {
+    Tick,              // uint32 (N)
+    HostTime,          // uint64 (N), host receive time in us (caller supplied)
+    MotorQ,            // float (N, 31)
+    MotorDq,           // float (N, 31)
+    MotorTau,          // float (N, 31)
+    MotorTemperature,  // int16 (N, 31)
+    MotorStatus,       // uint32 (N, 31)
+    JointQ,            // float (N, 31)
+    JointDq,           // float (N, 31)
+    JointTau,          // float (N, 31)
+    JointStatus,       // uint32 (N, 31)
+    ImuQuaternion,     // float (N, 4)
+    ImuGyroscope,      // float (N, 3)
+    ImuAccelerometer,  // float (N, 3)
+    ImuRpy,            // float (N, 3)
+    Count
+};
+
+enum class LowCmdField : size_t {
+    HostTime,       // uint64 (N)
+    KinematicMode,  // uint32 (N), 0: MS, 1: PJS
+    Q,              // float (N, 31)
+    Dq,             // float (N, 31)
+    Tau,            // float (N, 31)
+    Kp,             // float (N, 31)
+    Kd,             // float (N, 31)
+    Count
+};
+
+/**
+ * @brief Preallocated SoA ring of LowState samples with buffer-protocol views
+ *
+ * push() scatters a LowState into per-field columns (motor q of every sample is
+ * one contiguous (N, 31) float array, and so on). view(field) describes a column
+ * with shape and strides, so language bindings can expose it as a NumPy array
+ * that shares memory with the ring; reading joint state then costs no per-field
+ * calls. The ring never reallocates, so views stay valid for its lifetime.
+ *
+ * One thread pushes (e.g. the Subscriber<LowState> callback); any number of
+ * readers index the views with slot(seq). A reader must check readable(seq)
+ * after copying a sample: the writer overwrites the oldest slot without waiting.
+ *
+ * Example:
+ * @code
+ * LowStateRing ring(1024);
+ * sub.init([&](const LowState &s) { ring.push(s, ClockSync::now_us()); });
+ * ...
+ * uint64_t seq = ring.sequence() - 1;  // latest sample
+ * const float *q = ring.at<float>(LowStateField::JointQ, seq);
+ * // pybind11: py::array(py::buffer_info(v.data, v.itemsize, v.format, v.ndim, shape, strides), owner)
+ * @endcode
+ */
+class LowStateRing {
+  public:
+    static constexpr LowStateField HOST_TIME = LowStateField::HostTime;
+
+    explicit LowStateRing(size_t capacity = 1024) : ring_(capacity, columns()) {}
+
+    // Writer: append one sample (host_us: receive time, e.g. ClockSync::now_us())
+    void push(const LowState &state, uint64_t host_us = 0) {
+        *ring_.next<uint32_t>(col(LowStateField::Tick))     = state.tick();
+        *ring_.next<uint64_t>(col(LowStateField::HostTime)) = host_us;
+
+        float *mq    = ring_.next<float>(col(LowStateField::MotorQ));
+        float *mdq   = ring_.next<float>(col(LowStateField::MotorDq));
+        float *mtau  = ring_.next<float>(col(LowStateField::MotorTau));
+        int16_t *mt  = ring_.next<int16_t>(col(LowStateField::MotorTemperature));
+        uint32_t *ms = ring_.next<uint32_t>(col(LowStateField::MotorStatus));
+        float *jq    = ring_.next<float>(col(LowStateField::JointQ));
+        float *jdq   = ring_.next<float>(col(LowStateField::JointDq));
+        float *jtau  = ring_.next<float>(col(LowStateField::JointTau));
+        uint32_t *js = ring_.next<uint32_t>(col(LowStateField::JointStatus));
+        for (size_t i = 0; i < N_JOINTS; i++) {
+            const MotorState &m = state.motor_state()[i];
+            const JointState &j = state.joint_state()[i];
+            mq[i]               = m.q();
+            mdq[i]              = m.dq();
+            mtau[i]             = m.tau_est();
+            mt[i]               = m.temperature();
+            ms[i]               = m.status_bits();
+            jq[i]               = j.q();
+            jdq[i]              = j.dq();
+            jtau[i]             = j.tau_est();
+            js[i]               = j.status_bits();
+        }
+
+        const IMUState &imu = state.imu_state();
+        std::memcpy(ring_.next<float>(col(LowStateField::ImuQuaternion)), imu.quaternion().data(), 4 * sizeof(float));
+        std::memcpy(ring_.next<float>(col(LowStateField::ImuGyroscope)), imu.gyroscope().data(), 3 * sizeof(float));
+        std::memcpy(ring_.next<float>(col(LowStateField::ImuAccelerometer)), imu.accelerometer().data(), 3 * sizeof(float));
+        std::memcpy(ring_.next<float>(col(LowStateField::ImuRpy)), imu.rpy().data(), 3 * sizeof(float));
+        ring_.publish();
+    }
+
+    size_t capacity() const { return ring_.capacity(); }
+    uint64_t sequence() const { return ring_.sequence(); }
+    size_t slot(uint64_t seq) const { return ring_.slot(seq); }
+    bool readable(uint64_t seq) const { return ring_.readable(seq); }
+
+    // Whole column as a (capacity, ...) array indexed by slot(seq)
+    ArrayView view(LowStateField field) const { return ring_.view(col(field)); }
+
+    // First element of a field of sample seq (T must match the field type)
+    template <typename T> const T *at(LowStateField field, uint64_t seq) const { return ring_.at<T>(col(field), seq); }
+
+    // Copy a field of samples [first, first + count) into a contiguous (count, ...) array (count <= capacity())
+    void copy(LowStateField field, uint64_t first, size_t count, void *out) const { ring_.copy(col(field), first, count, out); }
+
+  private:
+    static constexpr size_t N_FIELDS = static_cast<size_t>(LowStateField::Count);
+    static constexpr size_t col(LowStateField f) { return static_cast<size_t>(f); }
+
+    static std::array<detail::RingColumn, N_FIELDS> columns() {
+        using detail::scalar_column;
+        using detail::vector_column;
+        return {{scalar_column<uint32_t>(), scalar_column<uint64_t>(), vector_column<float>(N_JOINTS), vector_column<float>(N_JOINTS),
+                 vector_column<float>(N_JOINTS), vector_column<int16_t>(N_JOINTS), vector_column<uint32_t>(N_JOINTS),
+                 vector_column<float>(N_JOINTS), vector_column<float>(N_JOINTS), vector_column<float>(N_JOINTS),
+                 vector_column<uint32_t>(N_JOINTS), vector_column<float>(4), vector_column<float>(3), vector_column<float>(3),
+                 vector_column<float>(3)}};
+    }
+
+    detail::ColumnRing<N_FIELDS> ring_;
+};
+
+/**
+ * @brief Preallocated SoA ring of LowCmd samples (e.g. for logging sent commands)
+ *
+ * Same layout and threading rules as LowStateRing.
+ */
+class LowCmdRing {
+  public:
+    static constexpr LowCmdField HOST_TIME = LowCmdField::HostTime;
+
+    explicit LowCmdRing(size_t capacity = 1024) : ring_(capacity, columns()) {}
+
+    // Writer: append one command
+    void push(const LowCmd &cmd, uint64_t host_us = 0) {
+        *ring_.next<uint64_t>(col(LowCmdField::HostTime))      = host_us;
+        *ring_.next<uint32_t>(col(LowCmdField::KinematicMode)) = cmd.kinematic_mode() == KinematicMode::PJS ? 1u : 0u;
+
+        float *q   = ring_.next<float>(col(LowCmdField::Q));
+        float *dq  = ring_.next<float>(col(LowCmdField::Dq));
+        float *tau = ring_.next<float>(col(LowCmdField::Tau));
+        float *kp  = ring_.next<float>(col(LowCmdField::Kp));
+        float *kd  = ring_.next<float>(col(LowCmdField::Kd));
+        for (size_t i = 0; i < N_JOINTS; i++) {
+            const MotorCmd &m = cmd.motors()[i];
+            q[i]              = m.q();
+            dq[i]             = m.dq();
+            tau[i]            = m.tau();
+            kp[i]             = m.kp();
+            kd[i]             = m.kd();
+        }
+        ring_.publish();
+    }
+
+    size_t capacity() const { return ring_.capacity(); }
+    uint64_t sequence() const { return ring_.sequence(); }
+    size_t slot(uint64_t seq) const { return ring_.slot(seq); }
+    bool readable(uint64_t seq) const { return ring_.readable(seq); }
+
+    ArrayView view(LowCmdField field) const { return ring_.view(col(field)); }
+
+    template <typename T> const T *at(LowCmdField field, uint64_t seq) const { return ring_.at<T>(col(field), seq); }
+
+    void copy(LowCmdField field, uint64_t first, size_t count, void *out) const { ring_.copy(col(field), first, count, out); }
+
+  private:
+    static constexpr size_t N_FIELDS = static_cast<size_t>(LowCmdField::Count);
+    static constexpr size_t col(LowCmdField f) { return static_cast<size_t>(f); }
+
+    static std::array<detail::RingColumn, N_FIELDS> columns() {
+        using detail::scalar_column;
+        using detail::vector_column;
+        return {{scalar_column<uint64_t>(), scalar_column<uint32_t>(), vector_column<float>(N_JOINTS), vector_column<float>(N_JOINTS),
+                 vector_column<float>(N_JOINTS), vector_column<float>(N_JOINTS), vector_column<float>(N_JOINTS)}};
+    }
+
+    detail::ColumnRing<N_FIELDS> ring_;
+};
+
+}  // namespace igris_sdk
@@ -1,14 +1,24 @@
 #pragma once
 
+#include "igris_sdk/channel_factory.hpp"
+#include "igris_sdk/dds_wait.hpp"
+#include "igris_sdk/entity_cache.hpp"
+
 #include <atomic>
 #include <dds/dds.hpp>
 #include <functional>
+#include <iostream>
 #include <memory>
 #include <string>
 #include <thread>
+#include <utility>
 
 namespace igris_sdk {
 
+// The constructor, destructor, init(callback), start(), stop() and the listener thread of
+// the built-in message types are instantiated in libigris_sdk.a. Members defined in this
+// header (init(ChannelFactory &, ...), poll(), wait_for_publishers(), ...) are not: they are
+// instantiated in the including TU for every type (see subscriber_impl.hpp).
 template <typename MessageType> class Subscriber {
   public:
     using CallbackType = std::function<void(const MessageType &)>;
@@ -19,8 +29,18 @@ template <typename MessageType> class Subscriber {
     // Initialize DDS subscriber with callback (Cyclone DDS)
     // Note: ChannelFactory must be initialized before calling this
     // Automatically starts listening after initialization
+    // For the built-in message types this is library code that ignores ChannelFactory::SetPartition().
     bool init(CallbackType callback);
 
+    // Initialize on a given factory instead of ChannelFactory::Instance(), e.g. one
+    // factory (DomainParticipant) per robot domain. With listen = false no listener
+    // thread is started: deliver samples with poll() or a shared ReceiveThread.
+    bool init(ChannelFactory &factory, CallbackType callback, bool listen = true);
+
+    // Take all available samples and run the callback on the calling thread.
+    // Returns the number of samples delivered. Do not mix with a running listener thread.
+    size_t poll();
+
     // Stop listening (can be restarted with start())
     void stop();
 
@@ -33,6 +53,33 @@ template <typename MessageType> class Subscriber {
     // Check if subscriber is running
     bool is_running() const { return running_; }
 
+    // Underlying reader (valid after init), e.g. for wait sets
+    dds::sub::DataReader<MessageType> &reader() { return *reader_; }
+
+    // Block until at least n writers are matched (subscription-matched status, no polling).
+    // Returns false on timeout or if not initialized.
+    bool wait_for_publishers(int32_t n = 1, int timeout_ms = 5000) {
+        if (!initialized_) return false;
+        dds::core::cond::StatusCondition cond(*reader_);
+        cond.enabled_statuses(dds::core::status::StatusMask::subscription_matched());
+        return detail::wait_for_condition(cond, [&] { return reader_->subscription_matched_status().current_count() >= n; }, timeout_ms);
+    }
+
+    // Number of currently matched writers
+    int32_t matched_publishers() const { return initialized_ ? reader_->subscription_matched_status().current_count() : 0; }
+
+    // Block until a sample arrives at the reader; the callback runs on the listener thread
+    // right after (within its 1ms take period). A sample the listener takes before the
+    // wait set evaluates it can go unnoticed, so use this on periodic topics (e.g. LowState).
+    // Returns false on timeout or if not initialized.
+    bool wait_for_first_sample(int timeout_ms = 5000) {
+        if (!initialized_) return false;
+        dds::sub::cond::ReadCondition cond(*reader_, dds::sub::status::DataState::any());
+        // The only wake-up source is the read condition, so any wake-up means a sample arrived
+        bool waited = false;
+        return detail::wait_for_condition(cond, [&] { return std::exchange(waited, true) || cond.trigger_value(); }, timeout_ms);
+    }
+
   private:
     void listenerThread();
 
@@ -48,4 +95,59 @@ template <typename MessageType> class Subscriber {
     std::atomic<bool> running_;
 };
 
+template <typename MessageType> inline bool Subscriber<MessageType>::init(ChannelFactory &factory, CallbackType callback, bool listen) {
+    if (initialized_) {
+        std::cerr << "[Subscriber] Already initialized" << std::endl;
+        return false;
+    }
+
+    callback_ = callback;
+
+    try {
+        auto participant = factory.GetParticipant();
+        if (!participant) {
+            std::cerr << "[Subscriber] ChannelFactory not initialized. Call Init() first." << std::endl;
+            return false;
+        }
+
+        // Topic and Subscriber entities are shared with the other endpoints of this
+        // participant and partition (see ChannelFactory::SetPartition())
+        dds::sub::qos::SubscriberQos subscriber_qos = participant->default_subscriber_qos();
+        std::string partition                       = factory.GetPartition();
+        if (!partition.empty()) subscriber_qos << dds::core::policy::Partition(partition);
+        topic_      = EntityCache::Instance().topic<MessageType>(*participant, topic_name_);
+        subscriber_ = EntityCache::Instance().subscriber(*participant, subscriber_qos);
+
+        // RELIABLE (100ms max blocking) + KEEP_LAST 10, same as the built-in topics
+        dds::sub::qos::DataReaderQos qos = subscriber_->default_datareader_qos();
+        qos << dds::core::policy::Reliability::Reliable(dds::core::Duration::from_millisecs(100)) << dds::core::policy::History::KeepLast(10);
+
+        reader_ = std::make_shared<dds::sub::DataReader<MessageType>>(*subscriber_, *topic_, qos, nullptr, dds::core::status::StatusMask::none());
+
+        std::cout << "[Subscriber] Initialized topic: " << topic_name_ << std::endl;
+        initialized_ = true;
+        return listen ? start() : true;
+    } catch (const dds::core::Exception &e) {
+        std::cerr << "[Subscriber] DDS Exception: " << e.what() << std::endl;
+        return false;
+    }
+}
+
+template <typename MessageType> inline size_t Subscriber<MessageType>::poll() {
+    if (!initialized_) return 0;
+
+    size_t delivered = 0;
+    try {
+        auto samples = reader_->take();
+        for (const auto &sample : samples) {
+            if (sample.info().valid()) {
+                callback_(sample.data());
+                delivered++;
+            }
+        }
+    } catch (const dds::core::Exception &) {
+    }
+    return delivered;
+}
+
 }  // namespace igris_sdk
@@ -0,0 +1,95 @@
+#pragma once
+
+/**
+ * @brief Template definitions of Subscriber<T>
+ *
+ * Counterpart of publisher_impl.hpp: include this header instead of
+ * subscriber.hpp to subscribe to your own IDL types. The library members of
+ * the built-in igris_c::msg::dds types stay extern templates and link against
+ * the instantiations in libigris_sdk.a.
+ *
+ * Example:
+ * @code
+ * #include "igris_sdk/subscriber_impl.hpp"
+ * #include "my_msgs.hpp"
+ *
+ * igris_sdk::Subscriber<my_msgs::FootForce> sub("rt/foot_force");
+ * sub.init([](const my_msgs::FootForce &msg) { ... });
+ * @endcode
+ */
+
+#include "igris_sdk/channel_factory.hpp"
+#include "igris_sdk/igris_c_msgs.hpp"
+#include "igris_sdk/subscriber.hpp"
+
+#include <chrono>
+#include <iostream>
+
+namespace igris_sdk {
+
+template <typename MessageType>
+Subscriber<MessageType>::Subscriber(const std::string &topic_name) : topic_name_(topic_name), initialized_(false), running_(false) {}
+
+template <typename MessageType> Subscriber<MessageType>::~Subscriber() {
+    running_ = false;
+    if (listener_thread_.joinable()) listener_thread_.join();
+}
+
+template <typename MessageType> bool Subscriber<MessageType>::init(CallbackType callback) {
+    return init(*ChannelFactory::Instance(), callback);
+}
+
+template <typename MessageType> bool Subscriber<MessageType>::start() {
+    if (!initialized_) {
+        std::cerr << "[Subscriber] Not initialized. Call init() first." << std::endl;
+        return false;
+    }
+    if (running_) {
+        std::cerr << "[Subscriber] Already running" << std::endl;
+        return false;
+    }
+
+    running_         = true;
+    listener_thread_ = std::thread(&Subscriber::listenerThread, this);
+    std::cout << "[Subscriber] Started topic: " << topic_name_ << std::endl;
+    return true;
+}
+
+template <typename MessageType> void Subscriber<MessageType>::stop() {
+    if (!running_.exchange(false)) return;
+
+    std::cout << "[Subscriber] Stopped topic: " << topic_name_ << std::endl;
+    if (listener_thread_.joinable()) listener_thread_.join();
+}
+
+template <typename MessageType> void Subscriber<MessageType>::listenerThread() {
+    // Poll with take() every 1ms; valid samples are handed to the callback on this thread
+    while (running_) {
+        poll();
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+}
+
+// Members instantiated in libigris_sdk.a for the built-in types (see publisher_impl.hpp);
+// header-only members (init(ChannelFactory &, ...), poll(), wait_for_publishers(), ...)
+// are not in the library and are instantiated implicitly.
+#define IGRIS_SDK_EXTERN_SUBSCRIBER(T)                                                    \
+    extern template Subscriber<T>::Subscriber(const std::string &);                      \
+    extern template Subscriber<T>::~Subscriber();                                        \
+    extern template bool Subscriber<T>::init(Subscriber<T>::CallbackType);               \
+    extern template bool Subscriber<T>::start();                                         \
+    extern template void Subscriber<T>::stop();                                          \
+    extern template void Subscriber<T>::listenerThread();
+
+IGRIS_SDK_EXTERN_SUBSCRIBER(igris_c::msg::dds::LowCmd)
+IGRIS_SDK_EXTERN_SUBSCRIBER(igris_c::msg::dds::LowState)
+IGRIS_SDK_EXTERN_SUBSCRIBER(igris_c::msg::dds::BmsState)
+IGRIS_SDK_EXTERN_SUBSCRIBER(igris_c::msg::dds::BmsInitCmd)
+IGRIS_SDK_EXTERN_SUBSCRIBER(igris_c::msg::dds::TorqueCmd)
+IGRIS_SDK_EXTERN_SUBSCRIBER(igris_c::msg::dds::ControlModeCmd)
+IGRIS_SDK_EXTERN_SUBSCRIBER(igris_c::msg::dds::ControlModeState)
+IGRIS_SDK_EXTERN_SUBSCRIBER(igris_c::msg::dds::ServiceResponse)
+
+#undef IGRIS_SDK_EXTERN_SUBSCRIBER
+
+}  // namespace igris_sdk
@@ -0,0 +1,331 @@
+#pragma once
+
+#include "igris_sdk/joint_math.hpp"
+#include "igris_sdk/types.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+namespace igris_sdk {
+
+// Bit j selects joint j (LowCmd/LowState index order)
+constexpr uint32_t ALL_JOINTS_MASK = (1u << N_JOINTS) - 1u;
+
+// Mask of joints first..last (inclusive)
+constexpr uint32_t joint_range_mask(uint16_t first, uint16_t last) {
+    return (last >= 31 ? ~0u : (1u << (last + 1)) - 1u) & ~((1u << first) - 1u);
+}
+
+constexpr uint32_t WAIST_MASK     = joint_range_mask(MotorIndex::WAIST_YAW, MotorIndex::WAIST_PITCH);
+constexpr uint32_t LEFT_LEG_MASK  = joint_range_mask(MotorIndex::L_HIP_PITCH, MotorIndex::L_ANKLE_ROLL);
+constexpr uint32_t RIGHT_LEG_MASK = joint_range_mask(MotorIndex::R_HIP_PITCH, MotorIndex::R_ANKLE_ROLL);
+constexpr uint32_t LEFT_ARM_MASK  = joint_range_mask(MotorIndex::L_SHOULDER_PITCH, MotorIndex::L_WRIST_PITCH);
+constexpr uint32_t RIGHT_ARM_MASK = joint_range_mask(MotorIndex::R_SHOULDER_PITCH, MotorIndex::R_WRIST_PITCH);
+constexpr uint32_t NECK_MASK      = joint_range_mask(MotorIndex::NECK_YAW, MotorIndex::NECK_PITCH);
+static_assert(NECK_MASK == ((1u << 29) | (1u << 30)), "neck joints are 29-30");
+static_assert((WAIST_MASK | LEFT_LEG_MASK | RIGHT_LEG_MASK | LEFT_ARM_MASK | RIGHT_ARM_MASK | NECK_MASK) ==
+                  ALL_JOINTS_MASK,
+              "joint group masks must cover every joint");
+
+enum class SplineOrder {
+    Cubic,    // C1: position and velocity continuous at waypoints
+    Quintic,  // C2: position, velocity and acceleration continuous at waypoints
+};
+
+/**
+ * @brief Streams spline trajectories into LowCmd at control rate
+ *
+ * Each joint has its own fixed-capacity waypoint ring, allocated at construction;
+ * push_waypoint() appends to the rings of the masked joints only, so a joint in
+ * the middle of a long segment never holds back the queue of another joint.
+ * Each joint consumes its waypoints independently: when it
+ * reaches the end of a segment, the next one is built as a Hermite spline
+ * (cubic or quintic) from the current end state to the next waypoint. Between
+ * segment changes, evaluate() only computes the normalized segment time per
+ * joint and runs a SIMD Horner evaluation over all joints (see joint_math.hpp),
+ * so it costs well under a microsecond and never allocates.
+ *
+ * A joint that runs out of waypoints holds its last position with zero velocity,
+ * and picks up new waypoints on the next evaluate() call, starting from that
+ * tick. Waypoints whose time has already passed are applied as a step.
+ *
+ * Threading: push_waypoint() may be called from one producer thread (e.g. a
+ * planner) while evaluate() runs on the control thread; reset() belongs to the
+ * control thread.
+ *
+ * Example:
+ * @code
+ * TrajectoryStreamer traj(SplineOrder::Quintic);
+ * traj.reset(current_q);
+ * traj.push_waypoint(now + 1.0, target_q, NECK_MASK);
+ * while (running) {
+ *     traj.evaluate(now, cmd);  // writes q/dq of active joints
+ *     publisher.write(cmd);
+ * }
+ * @endcode
+ */
+class TrajectoryStreamer {
+  public:
+    // capacity: waypoints queued per joint
+    explicit TrajectoryStreamer(SplineOrder order = SplineOrder::Quintic, size_t capacity = 256)
+        : order_(order), capacity_(std::max<size_t>(capacity, 1)), points_(N_JOINTS * capacity_) {
+        for (size_t j = 0; j < N_JOINTS; j++) {
+            write_[j].store(0, std::memory_order_relaxed);
+            read_[j].store(0, std::memory_order_relaxed);
+        }
+        for (size_t j = 0; j < LANES; j++) {
+            set_hold(j);
+        }
+    }
+
+    // ========== Producer ==========
+
+    // Queue a waypoint for the masked joints; dq/ddq may be nullptr (zero velocity/acceleration).
+    // Arrays are indexed by joint. Returns false (queuing nothing) if a masked joint's queue is full.
+    bool push_waypoint(double t, const float *q, const float *dq, const float *ddq, uint32_t mask = ALL_JOINTS_MASK) {
+        mask &= ALL_JOINTS_MASK;
+        for (size_t j = 0; j < N_JOINTS; j++) {
+            if ((mask & (1u << j)) &&
+                write_[j].load(std::memory_order_relaxed) - read_[j].load(std::memory_order_acquire) >= capacity_) {
+                return false;
+            }
+        }
+        for (size_t j = 0; j < N_JOINTS; j++) {
+            if (!(mask & (1u << j))) continue;
+            uint64_t w     = write_[j].load(std::memory_order_relaxed);
+            JointPoint &pt = points_[j * capacity_ + w % capacity_];
+            pt.t           = t;
+            pt.q           = q[j];
+            pt.dq          = dq ? dq[j] : 0.0f;
+            pt.ddq         = ddq ? ddq[j] : 0.0f;
+            write_[j].store(w + 1, std::memory_order_release);
+        }
+        return true;
+    }
+
+    // Rest-to-rest waypoint (minimum-jerk profile with SplineOrder::Quintic)
+    bool push_waypoint(double t, const JointArray &q, uint32_t mask = ALL_JOINTS_MASK) {
+        return push_waypoint(t, q.data(), nullptr, nullptr, mask);
+    }
+
+    bool push_waypoint(double t, const JointArray &q, const JointArray &dq, uint32_t mask = ALL_JOINTS_MASK) {
+        return push_waypoint(t, q.data(), dq.data(), nullptr, mask);
+    }
+
+    // Largest number of waypoints queued for one joint and not yet consumed
+    size_t pending() const {
+        uint64_t n = 0;
+        for (size_t j = 0; j < N_JOINTS; j++) {
+            n = std::max(n, write_[j].load(std::memory_order_acquire) - read_[j].load(std::memory_order_acquire));
+        }
+        return static_cast<size_t>(n);
+    }
+
+    // ========== Control thread ==========
+
+    // Hold the masked joints at q (indexed by joint) and drop all queued waypoints
+    void reset(const float *q, uint32_t mask = ALL_JOINTS_MASK) {
+        for (size_t j = 0; j < N_JOINTS; j++) {
+            read_[j].store(write_[j].load(std::memory_order_acquire), std::memory_order_release);
+            if (mask & (1u << j)) {
+                active_ |= 1u << j;
+                end_q_[j] = q[j];
+                set_hold(j);
+            }
+        }
+    }
+
+    void reset(const JointArray &q, uint32_t mask = ALL_JOINTS_MASK) { reset(q.data(), mask); }
+
+    // Joints that have a position (from reset() or a first waypoint)
+    uint32_t active_mask() const { return active_; }
+
+    // True when every active joint holds its final position and nothing is queued
+    bool finished() const {
+        for (size_t j = 0; j < N_JOINTS; j++) {
+            if ((active_ & (1u << j)) && !holding_[j]) return false;
+        }
+        return pending() == 0;
+    }
+
+    // Evaluate position and velocity of every joint at time t (q/dq: N_JOINTS floats).
+    // Inactive joints are reported as 0.
+    void evaluate(double t, float *q, float *dq) {
+        update(t);
+        for (size_t j = 0; j < N_JOINTS; j++) {
+            q[j]  = q_out_[j];
+            dq[j] = dq_out_[j];
+        }
+    }
+
+    // Write q and dq of the active joints into cmd; other fields and inactive joints are left untouched
+    void evaluate(double t, LowCmd &cmd) {
+        update(t);
+        auto &motors = cmd.motors();
+        for (size_t j = 0; j < N_JOINTS; j++) {
+            if (active_ & (1u << j)) {
+                motors[j].q(q_out_[j]);
+                motors[j].dq(dq_out_[j]);
+            }
+        }
+    }
+
+  private:
+    // Per-joint arrays are padded to a whole number of SIMD vectors
+    static constexpr size_t LANES = 32;
+    static constexpr int DEGREE   = 5;
+
+    // One joint's share of a waypoint
+    struct JointPoint {
+        double t  = 0.0;
+        float q   = 0.0f;
+        float dq  = 0.0f;
+        float ddq = 0.0f;
+    };
+
+    void update(double t) {
+        for (size_t j = 0; j < N_JOINTS; j++) {
+            if (t >= t1_[j]) {
+                advance(j, t);
+            }
+            double s = (t - t0_[j]) * inv_T_[j];
+            s_[j]    = static_cast<float>(std::clamp(s, 0.0, 1.0));
+        }
+        evaluate_polynomials();
+    }
+
+    // Move joint j to the segment containing t, or hold
+    void advance(size_t j, double t) {
+        const uint64_t w = write_[j].load(std::memory_order_acquire);
+        uint64_t r       = read_[j].load(std::memory_order_relaxed);
+        while (t >= t1_[j]) {
+            if (r == w) {
+                if (!holding_[j]) set_hold(j);
+                break;
+            }
+            // Copy out before handing the slot back to the producer
+            const JointPoint pt = points_[j * capacity_ + r % capacity_];
+            read_[j].store(++r, std::memory_order_release);
+
+            // First waypoint of an inactive joint defines its position
+            if (!(active_ & (1u << j))) {
+                active_ |= 1u << j;
+                end_q_[j] = pt.q;
+                set_hold(j);
+                continue;
+            }
+
+            // Continue from the previous segment end, or from now if the joint was idle
+            double start = holding_[j] ? t : t1_[j];
+            if (pt.t <= start) {
+                end_q_[j]   = pt.q;
+                end_dq_[j]  = pt.dq;
+                end_ddq_[j] = pt.ddq;
+                t1_[j]      = start;
+                holding_[j] = false;
+                continue;
+            }
+            set_segment(j, start, pt);
+        }
+    }
+
+    void set_hold(size_t j) {
+        for (int k = 0; k <= DEGREE; k++) c_[k][j] = 0.0f;
+        for (int k = 0; k < DEGREE; k++) d_[k][j] = 0.0f;
+        c_[0][j]    = end_q_[j];
+        end_dq_[j]  = 0.0f;
+        end_ddq_[j] = 0.0f;
+        inv_T_f_[j] = 0.0f;
+        inv_T_[j]   = 0.0;
+        t0_[j]      = 0.0;
+        t1_[j]      = -HUGE_VAL;  // re-check the queue on every tick
+        holding_[j] = true;
+    }
+
+    // Hermite segment from the current end state to wp over [start, wp.t], in normalized time s in [0, 1]
+    void set_segment(size_t j, double start, const JointPoint &wp) {
+        double T  = wp.t - start;
+        double p0 = end_q_[j], v0 = end_dq_[j] * T, a0 = end_ddq_[j] * T * T;
+        double p1 = wp.q, v1 = wp.dq * T, a1 = wp.ddq * T * T;
+        double h  = p1 - p0;
+
+        double c[DEGREE + 1] = {p0, v0, 0.0, 0.0, 0.0, 0.0};
+        if (order_ == SplineOrder::Cubic) {
+            c[2] = 3.0 * h - 2.0 * v0 - v1;
+            c[3] = -2.0 * h + v0 + v1;
+        } else {
+            c[2] = 0.5 * a0;
+            c[3] = 10.0 * h - 6.0 * v0 - 4.0 * v1 - 1.5 * a0 + 0.5 * a1;
+            c[4] = -15.0 * h + 8.0 * v0 + 7.0 * v1 + 1.5 * a0 - a1;
+            c[5] = 6.0 * h - 3.0 * v0 - 3.0 * v1 - 0.5 * a0 + 0.5 * a1;
+        }
+        for (int k = 0; k <= DEGREE; k++) c_[k][j] = static_cast<float>(c[k]);
+        for (int k = 0; k < DEGREE; k++) d_[k][j] = static_cast<float>((k + 1) * c[k + 1]);
+
+        t0_[j]      = start;
+        t1_[j]      = wp.t;
+        inv_T_[j]   = 1.0 / T;
+        inv_T_f_[j] = static_cast<float>(inv_T_[j]);
+        end_q_[j]   = wp.q;
+        end_dq_[j]  = wp.dq;
+        end_ddq_[j] = order_ == SplineOrder::Cubic ? 0.0f : wp.ddq;
+        holding_[j] = false;
+    }
+
+    // q = sum c_k s^k, dq = (sum d_k s^k) / T, all joints at once
+    void evaluate_polynomials() {
+        size_t i = 0;
+#if defined(IGRIS_SDK_JOINT_MATH_AVX) || defined(IGRIS_SDK_JOINT_MATH_SSE)
+        using S = detail::JointSimd;
+        for (; i < LANES; i += S::W) {
+            S::F s = S::load(s_ + i);
+            S::F q = S::load(c_[DEGREE] + i);
+            for (int k = DEGREE - 1; k >= 0; k--) q = S::add(S::mul(q, s), S::load(c_[k] + i));
+            S::F v = S::load(d_[DEGREE - 1] + i);
+            for (int k = DEGREE - 2; k >= 0; k--) v = S::add(S::mul(v, s), S::load(d_[k] + i));
+            S::store(q_out_ + i, q);
+            S::store(dq_out_ + i, S::mul(v, S::load(inv_T_f_ + i)));
+        }
+#endif
+        for (; i < LANES; i++) {
+            float s = s_[i];
+            float q = c_[DEGREE][i];
+            for (int k = DEGREE - 1; k >= 0; k--) q = q * s + c_[k][i];
+            float v = d_[DEGREE - 1][i];
+            for (int k = DEGREE - 2; k >= 0; k--) v = v * s + d_[k][i];
+            q_out_[i]  = q;
+            dq_out_[i] = v * inv_T_f_[i];
+        }
+    }
+
+    SplineOrder order_;
+
+    // Per-joint waypoint rings of capacity_ points each (single producer, single consumer)
+    size_t capacity_;
+    std::vector<JointPoint> points_;
+    std::atomic<uint64_t> write_[N_JOINTS];
+    std::atomic<uint64_t> read_[N_JOINTS];
+
+    // Per-joint segment state (control thread only)
+    uint32_t active_      = 0;
+    bool holding_[LANES]  = {};
+    double t0_[LANES]     = {};
+    double t1_[LANES]     = {};
+    double inv_T_[LANES]  = {};
+    float end_q_[LANES]   = {};
+    float end_dq_[LANES]  = {};
+    float end_ddq_[LANES] = {};
+
+    // SoA polynomial coefficients and evaluation buffers
+    alignas(32) float c_[DEGREE + 1][LANES] = {};
+    alignas(32) float d_[DEGREE][LANES]     = {};
+    alignas(32) float inv_T_f_[LANES]       = {};
+    alignas(32) float s_[LANES]             = {};
+    alignas(32) float q_out_[LANES]         = {};
+    alignas(32) float dq_out_[LANES]        = {};
+};
+
+}  // namespace igris_sdk
@@ -90,48 +90,51 @@ enum MotorError : uint32_t {
 constexpr int NUM_MOTORS    = 31;
 constexpr uint32_t N_JOINTS = igris_c::msg::dds::N_JOINTS;
 
-// Motor index definitions for Motor Space (MS)
+// LowCmd/LowState index of each joint (same order as joint_limits.hpp and the GUI client).
+// Names are the PJS joints; in MS the parallel pairs are driven by the motors noted alongside.
 namespace MotorIndex {
-// Left Leg (0-5)
-constexpr uint16_t L_HIP_PITCH   = 0;
-constexpr uint16_t L_HIP_ROLL    = 1;
-constexpr uint16_t L_HIP_YAW     = 2;
-constexpr uint16_t L_KNEE        = 3;
-constexpr uint16_t L_ANKLE_PITCH = 4;
-constexpr uint16_t L_ANKLE_ROLL  = 5;
-
-// Right Leg (6-11)
-constexpr uint16_t R_HIP_PITCH   = 6;
-constexpr uint16_t R_HIP_ROLL    = 7;
-constexpr uint16_t R_HIP_YAW     = 8;
-constexpr uint16_t R_KNEE        = 9;
-constexpr uint16_t R_ANKLE_PITCH = 10;
-constexpr uint16_t R_ANKLE_ROLL  = 11;
-
-// Waist (12-14)
-constexpr uint16_t WAIST_YAW   = 12;
-constexpr uint16_t WAIST_ROLL  = 13;
-constexpr uint16_t WAIST_PITCH = 14;
-
-// Left Arm (15-22)
+// Waist (0-2)
+constexpr uint16_t WAIST_YAW   = 0;
+constexpr uint16_t WAIST_ROLL  = 1;  // MS: Waist_L
+constexpr uint16_t WAIST_PITCH = 2;  // MS: Waist_R
+
+// Left Leg (3-8)
+constexpr uint16_t L_HIP_PITCH   = 3;
+constexpr uint16_t L_HIP_ROLL    = 4;
+constexpr uint16_t L_HIP_YAW     = 5;
+constexpr uint16_t L_KNEE        = 6;
+constexpr uint16_t L_ANKLE_PITCH = 7;  // MS: Ankle_Out_L
+constexpr uint16_t L_ANKLE_ROLL  = 8;  // MS: Ankle_In_L
+
+// Right Leg (9-14)
+constexpr uint16_t R_HIP_PITCH   = 9;
+constexpr uint16_t R_HIP_ROLL    = 10;
+constexpr uint16_t R_HIP_YAW     = 11;
+constexpr uint16_t R_KNEE        = 12;
+constexpr uint16_t R_ANKLE_PITCH = 13;  // MS: Ankle_Out_R
+constexpr uint16_t R_ANKLE_ROLL  = 14;  // MS: Ankle_In_R
+
+// Left Arm (15-21)
 constexpr uint16_t L_SHOULDER_PITCH = 15;
 constexpr uint16_t L_SHOULDER_ROLL  = 16;
 constexpr uint16_t L_SHOULDER_YAW   = 17;
 constexpr uint16_t L_ELBOW          = 18;
-constexpr uint16_t L_WRIST_ROLL     = 19;
-constexpr uint16_t L_WRIST_PITCH    = 20;
-constexpr uint16_t L_WRIST_YAW      = 21;
-constexpr uint16_t L_HAND           = 22;
-
-// Right Arm (23-30)
-constexpr uint16_t R_SHOULDER_PITCH = 23;
-constexpr uint16_t R_SHOULDER_ROLL  = 24;
-constexpr uint16_t R_SHOULDER_YAW   = 25;
-constexpr uint16_t R_ELBOW          = 26;
-constexpr uint16_t R_WRIST_ROLL     = 27;
-constexpr uint16_t R_WRIST_PITCH    = 28;
-constexpr uint16_t R_WRIST_YAW      = 29;
-constexpr uint16_t R_HAND           = 30;
+constexpr uint16_t L_WRIST_YAW      = 19;
+constexpr uint16_t L_WRIST_ROLL     = 20;  // MS: Wrist_Front_L
+constexpr uint16_t L_WRIST_PITCH    = 21;  // MS: Wrist_Back_L
+
+// Right Arm (22-28)
+constexpr uint16_t R_SHOULDER_PITCH = 22;
+constexpr uint16_t R_SHOULDER_ROLL  = 23;
+constexpr uint16_t R_SHOULDER_YAW   = 24;
+constexpr uint16_t R_ELBOW          = 25;
+constexpr uint16_t R_WRIST_YAW      = 26;
+constexpr uint16_t R_WRIST_ROLL     = 27;  // MS: Wrist_Front_R
+constexpr uint16_t R_WRIST_PITCH    = 28;  // MS: Wrist_Back_R
+
+// Neck (29-30)
+constexpr uint16_t NECK_YAW   = 29;
+constexpr uint16_t NECK_PITCH = 30;
 }  // namespace MotorIndex
 
 }  // namespace igris_sdk
@@ -7,7 +7,7 @@
 
 namespace igris_sdk {
 
-// CRC32 calculation for command validation
+// CRC32 calculation for command validation (see crc32.hpp for accelerated variants)
 uint32_t crc32_core(const uint32_t *data, uint32_t len);
 
 // Get current timestamp in microseconds
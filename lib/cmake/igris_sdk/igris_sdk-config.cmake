@@ -78,4 +78,7 @@ if(TARGET igris_sdk::igris_sdk)
     )
 endif()
 
+# Optional variants (COMPONENTS generic, x86-64-v3, lto, shared)
+include("${CMAKE_CURRENT_LIST_DIR}/igris_sdk-variants.cmake")
+
 check_required_components(igris_sdk)
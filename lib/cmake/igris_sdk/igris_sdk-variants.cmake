@@ -0,0 +1,97 @@
+# Optional build variants of libigris_sdk, selected with find_package() components:
+#
+#   find_package(igris_sdk REQUIRED COMPONENTS x86-64-v3)
+#   target_link_libraries(your_target igris_sdk::x86-64-v3)
+#
+# Components and targets:
+#   generic    igris_sdk::generic    lib/libigris_sdk.a (baseline x86-64, same as igris_sdk::igris_sdk)
+#   x86-64-v3  igris_sdk::x86-64-v3  lib/x86-64-v3/libigris_sdk.a (AVX2/FMA build of the library).
+#                                    With IGRIS_SDK_MARCH_X86_64_V3=ON, consumers are also compiled with
+#                                    -march=x86-64-v3, which enables the AVX paths of the header-only
+#                                    utilities (joint_math.hpp etc.)
+#   lto        igris_sdk::lto        lib/lto/libigris_sdk.a (GCC LTO objects); consumers are compiled and
+#                                    linked with -flto=auto for cross-module inlining
+#   shared     igris_sdk::shared     lib/libigris_sdk.so
+#
+# A component whose library is not part of this SDK package is reported as not found.
+
+set(_igris_sdk_interface_includes
+    "${IGRIS_SDK_ROOT}/include"
+    "${IGRIS_SDK_THIRDPARTY_INCLUDE_DIR}"
+    "${IGRIS_SDK_THIRDPARTY_INCLUDE_DIR}/ddscxx"
+)
+
+# Imported library with the same usage requirements as igris_sdk::igris_sdk
+function(_igris_sdk_add_variant target type location)
+    if(TARGET ${target})
+        return()
+    endif()
+    add_library(${target} ${type} IMPORTED)
+    set_target_properties(${target} PROPERTIES
+        IMPORTED_LOCATION "${location}"
+        IMPORTED_LINK_INTERFACE_LANGUAGES "CXX"
+        INTERFACE_INCLUDE_DIRECTORIES "${_igris_sdk_interface_includes}"
+    )
+    if(type STREQUAL "STATIC")
+        # Cyclone DDS is linked into the shared library
+        target_link_libraries(${target} INTERFACE ddscxx ddsc Threads::Threads dl rt)
+    else()
+        target_link_libraries(${target} INTERFACE Threads::Threads)
+    endif()
+endfunction()
+
+# generic: the baseline archive
+set(igris_sdk_generic_FOUND TRUE)
+if(NOT TARGET igris_sdk::generic)
+    add_library(igris_sdk::generic INTERFACE IMPORTED)
+    target_link_libraries(igris_sdk::generic INTERFACE igris_sdk::igris_sdk)
+endif()
+
+# x86-64-v3: AVX2 archive; the consumer -march flag is opt-in
+option(IGRIS_SDK_MARCH_X86_64_V3 "Compile igris_sdk::x86-64-v3 consumers with -march=x86-64-v3" OFF)
+if(EXISTS "${IGRIS_SDK_ROOT}/lib/x86-64-v3/libigris_sdk.a")
+    set(igris_sdk_x86-64-v3_FOUND TRUE)
+    if(NOT TARGET igris_sdk::x86-64-v3)
+        _igris_sdk_add_variant(igris_sdk::x86-64-v3 STATIC "${IGRIS_SDK_ROOT}/lib/x86-64-v3/libigris_sdk.a")
+        if(IGRIS_SDK_MARCH_X86_64_V3)
+            target_compile_options(igris_sdk::x86-64-v3 INTERFACE -march=x86-64-v3)
+        endif()
+    endif()
+else()
+    set(igris_sdk_x86-64-v3_FOUND FALSE)
+    set(igris_sdk_x86-64-v3_NOT_FOUND_MESSAGE "lib/x86-64-v3/libigris_sdk.a is not part of this SDK package")
+endif()
+
+# lto: archive of GCC LTO objects; the final link must run the LTO plugin as well
+if(EXISTS "${IGRIS_SDK_ROOT}/lib/lto/libigris_sdk.a")
+    set(igris_sdk_lto_FOUND TRUE)
+    if(NOT TARGET igris_sdk::lto)
+        _igris_sdk_add_variant(igris_sdk::lto STATIC "${IGRIS_SDK_ROOT}/lib/lto/libigris_sdk.a")
+        target_compile_options(igris_sdk::lto INTERFACE -flto=auto)
+        target_link_options(igris_sdk::lto INTERFACE -flto=auto)
+    endif()
+else()
+    set(igris_sdk_lto_FOUND FALSE)
+    set(igris_sdk_lto_NOT_FOUND_MESSAGE "lib/lto/libigris_sdk.a is not part of this SDK package")
+endif()
+
+# shared
+if(EXISTS "${IGRIS_SDK_ROOT}/lib/libigris_sdk.so")
+    set(igris_sdk_shared_FOUND TRUE)
+    _igris_sdk_add_variant(igris_sdk::shared SHARED "${IGRIS_SDK_ROOT}/lib/libigris_sdk.so")
+else()
+    set(igris_sdk_shared_FOUND FALSE)
+    set(igris_sdk_shared_NOT_FOUND_MESSAGE "lib/libigris_sdk.so is not part of this SDK package")
+endif()
+
+foreach(_igris_sdk_comp IN LISTS igris_sdk_FIND_COMPONENTS)
+    if(NOT DEFINED igris_sdk_${_igris_sdk_comp}_FOUND)
+        set(igris_sdk_${_igris_sdk_comp}_FOUND FALSE)
+        set(igris_sdk_${_igris_sdk_comp}_NOT_FOUND_MESSAGE "Unknown component (generic, x86-64-v3, lto, shared)")
+    endif()
+    if(NOT igris_sdk_${_igris_sdk_comp}_FOUND AND NOT igris_sdk_FIND_QUIETLY)
+        message(STATUS "igris_sdk: component ${_igris_sdk_comp} not found: ${igris_sdk_${_igris_sdk_comp}_NOT_FOUND_MESSAGE}")
+    endif()
+endforeach()
+unset(_igris_sdk_comp)
+unset(_igris_sdk_interface_includes)